@@ -0,0 +1,218 @@
+#include "BenchHarness.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+namespace Bench {
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::printf("Usage: %s [--filter text] [--reps N] [--warmup N] [--json out.json]\n"
+                "       %*s [--compare baseline.json] [--threshold fraction] [--list]\n",
+                program, static_cast<int>(std::string(program).size()), "");
+}
+
+// Nearest-rank percentile of sorted samples
+double Percentile(const std::vector<double>& sorted, double fraction) {
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+// 1234.5 ns -> "1.23 us"
+std::string FormatNs(double ns) {
+    char buffer[32];
+    if (ns < 1000.0) {
+        std::snprintf(buffer, sizeof(buffer), "%.2f ns", ns);
+    } else if (ns < 1000000.0) {
+        std::snprintf(buffer, sizeof(buffer), "%.2f us", ns / 1000.0);
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%.2f ms", ns / 1000000.0);
+    }
+    return buffer;
+}
+
+} // namespace
+
+bool Options::Parse(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (arg == "--reps" && hasValue) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--warmup" && hasValue) {
+            warmup = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--json" && hasValue) {
+            jsonPath = argv[++i];
+        } else if (arg == "--compare" && hasValue) {
+            comparePath = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            threshold = std::atof(argv[++i]);
+        } else if (arg == "--list") {
+            list = true;
+        } else {
+            PrintUsage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+void Suite::Add(const std::string& name, size_t operations, std::function<void()> body,
+                std::function<void()> setup) {
+    benchmarks.push_back({ name, std::max<size_t>(operations, 1), std::move(body), std::move(setup) });
+}
+
+Result Suite::Measure(const Benchmark& benchmark, const Options& options) const {
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < options.warmup; i++) {
+        if (benchmark.setup) benchmark.setup();
+        benchmark.body();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(options.repetitions);
+    for (int i = 0; i < options.repetitions; i++) {
+        if (benchmark.setup) benchmark.setup();
+
+        auto start = Clock::now();
+        benchmark.body();
+        auto end = Clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        samples.push_back(ns / benchmark.operations);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    Result result;
+    result.name = benchmark.name;
+    result.operations = benchmark.operations;
+    result.repetitions = options.repetitions;
+    result.minNs = samples.front();
+    result.medianNs = Percentile(samples, 0.5);
+    result.p99Ns = Percentile(samples, 0.99);
+    double sum = 0.0;
+    for (double sample : samples) sum += sample;
+    result.meanNs = sum / samples.size();
+    return result;
+}
+
+int Suite::Run(const Options& options) {
+    if (options.list) {
+        for (const auto& benchmark : benchmarks) {
+            std::printf("%s\n", benchmark.name.c_str());
+        }
+        return 0;
+    }
+
+    std::printf("%-48s %12s %12s %12s %10s\n", "Benchmark (per op)", "min", "median", "p99", "ops/rep");
+
+    std::vector<Result> results;
+    for (const auto& benchmark : benchmarks) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) continue;
+
+        Result result = Measure(benchmark, options);
+        std::printf("%-48s %12s %12s %12s %10zu\n", result.name.c_str(), FormatNs(result.minNs).c_str(),
+                    FormatNs(result.medianNs).c_str(), FormatNs(result.p99Ns).c_str(), result.operations);
+        std::fflush(stdout);
+        results.push_back(result);
+    }
+
+    if (!options.jsonPath.empty() && !WriteJson(options.jsonPath, results)) {
+        return 1;
+    }
+    if (!options.comparePath.empty()) {
+        return Compare(options.comparePath, results, options.threshold);
+    }
+    return 0;
+}
+
+bool Suite::WriteJson(const std::string& path, const std::vector<Result>& results) const {
+    nlohmann::json root;
+    root["benchmarks"] = nlohmann::json::array();
+    for (const auto& result : results) {
+        root["benchmarks"].push_back({
+            { "name", result.name },
+            { "operations", result.operations },
+            { "repetitions", result.repetitions },
+            { "min_ns", result.minNs },
+            { "median_ns", result.medianNs },
+            { "p99_ns", result.p99Ns },
+            { "mean_ns", result.meanNs }
+        });
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[Bench] Failed to write " << path << std::endl;
+        return false;
+    }
+    file << root.dump(2) << std::endl;
+    std::cout << "[Bench] Results written to " << path << std::endl;
+    return true;
+}
+
+int Suite::Compare(const std::string& path, const std::vector<Result>& results, double threshold) const {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "[Bench] Failed to open baseline " << path << std::endl;
+        return 1;
+    }
+
+    std::unordered_map<std::string, double> baseline;
+    try {
+        nlohmann::json root;
+        file >> root;
+        for (const auto& entry : root.at("benchmarks")) {
+            baseline[entry.at("name").get<std::string>()] = entry.at("median_ns").get<double>();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[Bench] Invalid baseline " << path << ": " << e.what() << std::endl;
+        return 1;
+    }
+
+    // Medians are compared: robust against the odd preempted repetition
+    std::printf("\nCompared with %s (threshold %.0f%%)\n", path.c_str(), threshold * 100.0);
+    std::printf("%-48s %12s %12s %9s\n", "Benchmark", "baseline", "current", "change");
+
+    int regressions = 0;
+    for (const auto& result : results) {
+        auto it = baseline.find(result.name);
+        if (it == baseline.end()) {
+            std::printf("%-48s %12s %12s %9s\n", result.name.c_str(), "-",
+                        FormatNs(result.medianNs).c_str(), "new");
+            continue;
+        }
+
+        double change = it->second > 0.0 ? result.medianNs / it->second - 1.0 : 0.0;
+        const char* verdict = "";
+        if (change > threshold) {
+            verdict = "  REGRESSION";
+            regressions++;
+        } else if (change < -threshold) {
+            verdict = "  faster";
+        }
+        std::printf("%-48s %12s %12s %+8.1f%%%s\n", result.name.c_str(), FormatNs(it->second).c_str(),
+                    FormatNs(result.medianNs).c_str(), change * 100.0, verdict);
+    }
+
+    if (regressions > 0) {
+        std::printf("\n%d benchmark(s) regressed by more than %.0f%%\n", regressions, threshold * 100.0);
+        return 1;
+    }
+    std::printf("\nNo regressions\n");
+    return 0;
+}
+
+} // namespace Bench
@@ -0,0 +1,79 @@
+#ifndef MOLGA_BENCH_HARNESS_H
+#define MOLGA_BENCH_HARNESS_H
+
+// Minimal benchmark harness for molga_bench. Each benchmark body runs one
+// repetition of a fixed workload; the harness times warmup + measured
+// repetitions and reports min / median / p99 per operation, optionally as
+// JSON and compared against a previous run.
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+struct Options {
+    int warmup = 3;
+    int repetitions = 30;
+    std::string filter;             // Substring of the benchmark name
+    std::string jsonPath;           // Write results here
+    std::string comparePath;        // Baseline written by an earlier --json run
+    double threshold = 0.10;        // Median slowdown flagged as a regression
+    bool list = false;
+
+    // Returns false (after printing usage) on a bad command line
+    bool Parse(int argc, char** argv);
+};
+
+struct Result {
+    std::string name;
+    size_t operations = 0;          // Per repetition
+    int repetitions = 0;
+    double minNs = 0.0;             // Per operation
+    double medianNs = 0.0;
+    double p99Ns = 0.0;
+    double meanNs = 0.0;
+};
+
+class Suite {
+public:
+    // body runs one repetition performing `operations` operations. setup,
+    // if given, runs untimed before every repetition (e.g. to reset state
+    // the body consumes).
+    void Add(const std::string& name, size_t operations, std::function<void()> body,
+             std::function<void()> setup = nullptr);
+
+    // Runs every benchmark matching the filter. Returns the process exit
+    // code: 1 if --compare found a regression, otherwise 0.
+    int Run(const Options& options);
+
+private:
+    struct Benchmark {
+        std::string name;
+        size_t operations;
+        std::function<void()> body;
+        std::function<void()> setup;
+    };
+
+    Result Measure(const Benchmark& benchmark, const Options& options) const;
+    bool WriteJson(const std::string& path, const std::vector<Result>& results) const;
+    int Compare(const std::string& path, const std::vector<Result>& results, double threshold) const;
+
+    std::vector<Benchmark> benchmarks;
+};
+
+// Keep the optimizer from discarding a computed value
+template<typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+    (void)*sink;
+#endif
+}
+
+} // namespace Bench
+
+#endif // MOLGA_BENCH_HARNESS_H
@@ -0,0 +1,586 @@
+// Engine hot path benchmarks. Runs without a window: the null render
+// backend is selected so nothing touches GL.
+//
+// Usage: molga_bench [--filter text] [--reps N] [--warmup N] [--json out.json]
+//                    [--compare baseline.json] [--threshold fraction] [--list]
+//
+// Typical use: record a baseline on the current code, then compare:
+//   molga_bench --json baseline.json
+//   molga_bench --compare baseline.json
+
+#include "BenchHarness.h"
+#include "../src/Collision.h"
+#include "../src/Tilemap.h"
+#include "../src/Particle.h"
+#include "../src/TextRenderer.h"
+#include "../src/SpriteCuller.h"
+#include "../src/RenderQueue.h"
+#include "../src/RenderBackend.h"
+#include "../src/ECS/GameObject.h"
+#include "../src/ECS/Components/Transform.h"
+#include "../src/ECS/Components/SpriteRenderer.h"
+#include "../src/ECS/Components/BoxCollider2D.h"
+#include "../src/Core/SceneSerializer.h"
+#include "../src/Physics/PhysicsWorld.h"
+#include "../src/Physics/PhysicsQuery.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::mt19937 g_random(1234);
+
+float RandomFloat(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(g_random);
+}
+
+// Silences std::cout for its lifetime (the serializer logs every load/save)
+class MuteStdout {
+public:
+    MuteStdout() : previous(std::cout.rdbuf(sink.rdbuf())) {}
+    ~MuteStdout() { std::cout.rdbuf(previous); }
+
+private:
+    std::ostringstream sink;
+    std::streambuf* previous;
+};
+
+// Fixture data lives in shared_ptrs captured by the benchmark lambdas, so
+// it is destroyed with the Suite at the end of main, before the engine
+// singletons it refers to.
+
+// ============ Collision ============
+
+void AddCollisionBenchmarks(Bench::Suite& suite) {
+    constexpr size_t COUNT = 4096;
+
+    // Boxes and circles scattered so roughly half the pairs overlap
+    struct Data {
+        std::vector<AABB> boxesA, boxesB;
+        std::vector<Circle> circlesA, circlesB;
+    };
+    auto data = std::make_shared<Data>();
+    for (size_t i = 0; i < COUNT; i++) {
+        data->boxesA.emplace_back(RandomFloat(0, 100), RandomFloat(0, 100), RandomFloat(5, 40), RandomFloat(5, 40));
+        data->boxesB.emplace_back(RandomFloat(0, 100), RandomFloat(0, 100), RandomFloat(5, 40), RandomFloat(5, 40));
+        data->circlesA.emplace_back(RandomFloat(0, 100), RandomFloat(0, 100), RandomFloat(5, 25));
+        data->circlesB.emplace_back(RandomFloat(0, 100), RandomFloat(0, 100), RandomFloat(5, 25));
+    }
+
+    suite.Add("Collision::CheckAABB", COUNT, [data] {
+        int hits = 0;
+        for (size_t i = 0; i < COUNT; i++) hits += Collision::CheckAABB(data->boxesA[i], data->boxesB[i]);
+        Bench::DoNotOptimize(hits);
+    });
+
+    suite.Add("Collision::CheckAABBWithResult", COUNT, [data] {
+        float overlap = 0.0f;
+        for (size_t i = 0; i < COUNT; i++) {
+            overlap += Collision::CheckAABBWithResult(data->boxesA[i], data->boxesB[i]).overlapX;
+        }
+        Bench::DoNotOptimize(overlap);
+    });
+
+    suite.Add("Collision::CheckCircle", COUNT, [data] {
+        int hits = 0;
+        for (size_t i = 0; i < COUNT; i++) hits += Collision::CheckCircle(data->circlesA[i], data->circlesB[i]);
+        Bench::DoNotOptimize(hits);
+    });
+
+    suite.Add("Collision::CheckAABBCircleWithResult", COUNT, [data] {
+        float overlap = 0.0f;
+        for (size_t i = 0; i < COUNT; i++) {
+            overlap += Collision::CheckAABBCircleWithResult(data->boxesA[i], data->circlesB[i]).overlapX;
+        }
+        Bench::DoNotOptimize(overlap);
+    });
+}
+
+// ============ Tilemap ============
+
+void AddTilemapBenchmarks(Bench::Suite& suite) {
+    constexpr int MAP_SIZE = 256;
+    constexpr int TILE_SIZE = 32;
+    constexpr size_t QUERIES = 1024;
+
+    // 30% solid tiles, queried with player-sized boxes
+    struct Data {
+        Tilemap tilemap{ MAP_SIZE, MAP_SIZE, TILE_SIZE };
+        std::vector<AABB> queries;
+    };
+    auto data = std::make_shared<Data>();
+    data->tilemap.SetCollisionTile(1, true);
+    for (int y = 0; y < MAP_SIZE; y++) {
+        for (int x = 0; x < MAP_SIZE; x++) {
+            data->tilemap.SetTile(x, y, RandomFloat(0, 1) < 0.3f ? 1 : 0);
+        }
+    }
+    for (size_t i = 0; i < QUERIES; i++) {
+        data->queries.emplace_back(RandomFloat(0, data->tilemap.GetWorldWidth() - 64),
+                                   RandomFloat(0, data->tilemap.GetWorldHeight() - 64), 48.0f, 48.0f);
+    }
+
+    suite.Add("Tilemap::GetCollidingTiles 48x48", QUERIES, [data] {
+        size_t found = 0;
+        for (const AABB& box : data->queries) found += data->tilemap.GetCollidingTiles(box).size();
+        Bench::DoNotOptimize(found);
+    });
+
+    suite.Add("Tilemap::CheckCollision 48x48", QUERIES, [data] {
+        int hits = 0;
+        for (const AABB& box : data->queries) hits += data->tilemap.CheckCollision(box);
+        Bench::DoNotOptimize(hits);
+    });
+
+    suite.Add("Tilemap::ForEachCollidingTile 48x48", QUERIES, [data] {
+        size_t found = 0;
+        for (const AABB& box : data->queries) {
+            data->tilemap.ForEachCollidingTile(box, [&found](const AABB&) { found++; });
+        }
+        Bench::DoNotOptimize(found);
+    });
+
+    // Fast movers: each sweep crosses up to 8 cells
+    suite.Add("Tilemap::SweepAABB 48x48 256px", QUERIES, [data] {
+        float time = 0.0f;
+        for (size_t i = 0; i < data->queries.size(); i++) {
+            float angle = static_cast<float>(i) * 0.37f;
+            Vector2 velocity(std::cos(angle) * 256.0f, std::sin(angle) * 256.0f);
+            time += data->tilemap.SweepAABB(data->queries[i], velocity).time;
+        }
+        Bench::DoNotOptimize(time);
+    });
+}
+
+// ============ Particles ============
+
+void AddParticleBenchmarks(Bench::Suite& suite) {
+    constexpr int PARTICLES = 10000;
+
+    auto emitter = std::make_shared<ParticleEmitter>();
+    ParticleConfig config;
+    config.maxParticles = PARTICLES;
+    config.spawnRate = PARTICLES;       // Keeps the pool near full
+    config.minLife = 2.0f;
+    config.maxLife = 4.0f;
+    config.gravityY = -200.0f;
+    emitter->SetConfig(config);
+
+    // One frame of a full emitter; setup refills the pool so every
+    // repetition updates the same number of particles
+    suite.Add("ParticleEmitter::Update 10k", 1, [emitter] {
+        emitter->Update(1.0f / 60.0f);
+        Bench::DoNotOptimize(emitter->GetActiveCount());
+    }, [emitter] {
+        emitter->Burst(PARTICLES - emitter->GetActiveCount());
+    });
+}
+
+// ============ Transforms ============
+
+void AddTransformBenchmarks(Bench::Suite& suite) {
+    constexpr int CHAINS = 64;
+    constexpr int DEPTH = 32;
+
+    struct Data {
+        std::vector<std::unique_ptr<GameObject>> objects;
+        std::vector<Transform*> roots;
+        std::vector<Transform*> leaves;
+
+        // Children first, so no parent is destroyed before its children
+        ~Data() {
+            while (!objects.empty()) objects.pop_back();
+        }
+    };
+    auto data = std::make_shared<Data>();
+
+    for (int c = 0; c < CHAINS; c++) {
+        GameObject* parent = nullptr;
+        for (int d = 0; d < DEPTH; d++) {
+            data->objects.push_back(std::make_unique<GameObject>("Node"));
+            GameObject* obj = data->objects.back().get();
+            Transform* transform = obj->AddComponent<Transform>(10.0f, 0.0f);
+            transform->SetRotation(5.0f);
+            if (parent) {
+                obj->SetParent(parent);
+            } else {
+                data->roots.push_back(transform);
+            }
+            parent = obj;
+        }
+        data->leaves.push_back(parent->GetComponent<Transform>());
+    }
+
+    auto moveRoots = [data] {
+        for (Transform* root : data->roots) root->Translate(1.0f, 0.0f);
+    };
+
+    // Every root moved: each leaf read resolves its whole dirty chain
+    suite.Add("Transform::GetWorldPosition depth 32 (dirty)", CHAINS, [data] {
+        float sum = 0.0f;
+        for (const Transform* leaf : data->leaves) sum += leaf->GetWorldPosition().x;
+        Bench::DoNotOptimize(sum);
+    }, moveRoots);
+
+    suite.Add("Transform::GetWorldPosition depth 32 (cached)", CHAINS, [data] {
+        float sum = 0.0f;
+        for (const Transform* leaf : data->leaves) sum += leaf->GetWorldPosition().x;
+        Bench::DoNotOptimize(sum);
+    });
+
+    suite.Add("Transform::UpdateWorldTransforms 2k", data->objects.size(), [] {
+        Transform::UpdateWorldTransforms();
+    }, moveRoots);
+}
+
+// ============ GameObject ============
+
+class BenchScript : public Component {
+public:
+    std::string GetTypeName() const override { return "BenchScript"; }
+};
+
+void AddGameObjectBenchmarks(Bench::Suite& suite) {
+    constexpr size_t OBJECTS = 10000;
+
+    auto objects = std::make_shared<std::vector<std::unique_ptr<GameObject>>>();
+    for (size_t i = 0; i < OBJECTS; i++) {
+        objects->push_back(std::make_unique<GameObject>("Object"));
+        GameObject* obj = objects->back().get();
+        obj->AddComponent<Transform>();
+        obj->AddComponent<SpriteRenderer>();
+        obj->AddComponent<BoxCollider2D>(16.0f, 16.0f);
+        obj->AddComponent<BenchScript>();
+    }
+
+    suite.Add("GameObject::GetComponent<BoxCollider2D>", OBJECTS, [objects] {
+        size_t found = 0;
+        for (const auto& obj : *objects) found += obj->GetComponent<BoxCollider2D>() != nullptr;
+        Bench::DoNotOptimize(found);
+    });
+
+    // User component types take the dynamic_cast path
+    suite.Add("GameObject::GetComponent<script type>", OBJECTS, [objects] {
+        size_t found = 0;
+        for (const auto& obj : *objects) found += obj->GetComponent<BenchScript>() != nullptr;
+        Bench::DoNotOptimize(found);
+    });
+}
+
+// ============ SceneSerializer ============
+
+void AddSceneBenchmarks(Bench::Suite& suite) {
+    constexpr size_t OBJECTS = 1000;
+
+    struct Data {
+        std::vector<std::shared_ptr<GameObject>> scene;
+        std::vector<std::shared_ptr<GameObject>> loaded;
+        std::string jsonPath = (fs::temp_directory_path() / "molga_bench_scene.json").string();
+        std::string binaryPath = (fs::temp_directory_path() / "molga_bench_scene.mscene").string();
+
+        // Hot reload: the scene with one object moved, patched in and out
+        std::string editedPath = (fs::temp_directory_path() / "molga_bench_scene_edited.mscene").string();
+        std::vector<std::shared_ptr<GameObject>> patched;
+        SceneFingerprint fingerprint;
+        bool edited = false;
+    };
+    auto data = std::make_shared<Data>();
+
+    for (size_t i = 0; i < OBJECTS; i++) {
+        auto obj = std::make_shared<GameObject>("Object " + std::to_string(i));
+        obj->AddComponent<Transform>(RandomFloat(0, 1000), RandomFloat(0, 1000));
+        obj->AddComponent<SpriteRenderer>();
+        obj->AddComponent<BoxCollider2D>(32.0f, 32.0f);
+        data->scene.push_back(obj);
+    }
+    {
+        MuteStdout mute;
+        SceneSerializer::SaveScene(data->jsonPath, data->scene);
+        SceneSerializer::SaveSceneBinary(data->binaryPath, data->scene);
+
+        Transform* moved = data->scene[OBJECTS / 2]->GetComponent<Transform>();
+        Vector2 position = moved->GetPosition();
+        moved->SetPosition(-1.0f, -1.0f);
+        SceneSerializer::SaveSceneBinary(data->editedPath, data->scene);
+        moved->SetPosition(position.x, position.y);
+
+        SceneSerializer::LoadSceneBinary(data->binaryPath, data->patched, &data->fingerprint);
+    }
+
+    auto clearLoaded = [data] { data->loaded.clear(); };
+
+    suite.Add("SceneSerializer::SaveScene json 1k", 1, [data] {
+        MuteStdout mute;
+        SceneSerializer::SaveScene(data->jsonPath, data->scene);
+    });
+
+    suite.Add("SceneSerializer::LoadScene json 1k", 1, [data] {
+        MuteStdout mute;
+        SceneSerializer::LoadScene(data->jsonPath, data->loaded);
+    }, clearLoaded);
+
+    suite.Add("SceneSerializer::SaveSceneBinary 1k", 1, [data] {
+        MuteStdout mute;
+        SceneSerializer::SaveSceneBinary(data->binaryPath, data->scene);
+    });
+
+    suite.Add("SceneSerializer::LoadSceneBinary 1k", 1, [data] {
+        MuteStdout mute;
+        SceneSerializer::LoadSceneBinary(data->binaryPath, data->loaded);
+    }, clearLoaded);
+
+    // Compare with LoadSceneBinary: only the edited object is rebuilt
+    suite.Add("SceneSerializer::PatchScene binary 1k, 1 edited", 1, [data] {
+        MuteStdout mute;
+        data->edited = !data->edited;
+        SceneSerializer::PatchScene(data->edited ? data->editedPath : data->binaryPath,
+                                    data->patched, data->fingerprint);
+    });
+}
+
+// ============ Text ============
+
+void AddTextBenchmarks(Bench::Suite& suite) {
+    constexpr size_t STRINGS = 256;
+
+    TextRenderer::Get().Init();
+
+    auto strings = std::make_shared<std::vector<std::string>>();
+    const char* words[] = { "Score", "Health", "Molga", "Engine", "Level", "Player", "99", "!" };
+    for (size_t i = 0; i < STRINGS; i++) {
+        std::string text;
+        while (text.size() < 40) {
+            text += words[g_random() % 8];
+            text += ' ';
+        }
+        strings->push_back(text);
+    }
+
+    suite.Add("TextRenderer::GetTextWidth 40 chars", STRINGS, [strings] {
+        float width = 0.0f;
+        for (const auto& text : *strings) width += TextRenderer::Get().GetTextWidth(text);
+        Bench::DoNotOptimize(width);
+    });
+
+    // Glyph quads built by RenderText and TextMesh::Rebuild
+    auto quads = std::make_shared<std::vector<SpriteVertex>>();
+    suite.Add("TextRenderer::Layout 40 chars", STRINGS, [strings, quads] {
+        for (const auto& text : *strings) {
+            quads->clear();
+            TextRenderer::Get().Layout(text, 0.0f, 0.0f, 1.0f, Color::White(), *quads);
+        }
+        Bench::DoNotOptimize(quads->data());
+    });
+}
+
+// ============ Physics queries ============
+
+void AddQueryBenchmarks(Bench::Suite& suite) {
+    constexpr int MAP_SIZE = 256;
+    constexpr int TILE_SIZE = 32;
+    constexpr size_t COLLIDERS = 2048;
+    constexpr size_t QUERIES = 1024;
+    constexpr float DISTANCE = 512.0f;
+
+    // 10% solid tiles plus scattered colliders, cast from random points
+    struct Data {
+        Tilemap tilemap{ MAP_SIZE, MAP_SIZE, TILE_SIZE };
+        std::vector<std::shared_ptr<GameObject>> objects;
+        std::vector<CastCommand> commands;
+        std::vector<RaycastHit> results;
+    };
+    auto data = std::make_shared<Data>();
+    data->tilemap.SetCollisionTile(1, true);
+    for (int y = 0; y < MAP_SIZE; y++) {
+        for (int x = 0; x < MAP_SIZE; x++) {
+            data->tilemap.SetTile(x, y, RandomFloat(0, 1) < 0.1f ? 1 : 0);
+        }
+    }
+
+    float worldSize = data->tilemap.GetWorldWidth();
+    for (size_t i = 0; i < COLLIDERS; i++) {
+        auto obj = std::make_shared<GameObject>("Collider " + std::to_string(i));
+        obj->AddComponent<Transform>(RandomFloat(0, worldSize), RandomFloat(0, worldSize));
+        obj->AddComponent<BoxCollider2D>(RandomFloat(8, 64), RandomFloat(8, 64));
+        data->objects.push_back(obj);
+    }
+    PhysicsWorld::Get().Step();
+
+    for (size_t i = 0; i < QUERIES; i++) {
+        float angle = RandomFloat(0, 6.2831853f);
+        CastCommand command;
+        command.shape = static_cast<CastCommand::Shape>(i % 3);
+        command.origin = Vector2(RandomFloat(0, worldSize), RandomFloat(0, worldSize));
+        command.direction = Vector2(std::cos(angle), std::sin(angle));
+        command.maxDistance = DISTANCE;
+        command.radius = 12.0f;
+        command.halfExtents = Vector2(12.0f, 16.0f);
+        command.filter.tilemap = &data->tilemap;
+        data->commands.push_back(command);
+    }
+    data->results.resize(QUERIES);
+
+    suite.Add("PhysicsQuery::Raycast 512px", QUERIES, [data] {
+        float distance = 0.0f;
+        RaycastHit hit;
+        for (const CastCommand& command : data->commands) {
+            if (PhysicsQuery::Raycast(command.origin, command.direction, command.maxDistance, hit, command.filter)) {
+                distance += hit.distance;
+            }
+        }
+        Bench::DoNotOptimize(distance);
+    });
+
+    suite.Add("PhysicsQuery::CircleCast r12 512px", QUERIES, [data] {
+        float distance = 0.0f;
+        RaycastHit hit;
+        for (const CastCommand& command : data->commands) {
+            if (PhysicsQuery::CircleCast(command.origin, command.radius, command.direction, command.maxDistance,
+                                         hit, command.filter)) {
+                distance += hit.distance;
+            }
+        }
+        Bench::DoNotOptimize(distance);
+    });
+
+    // Mixed rays, circles and boxes
+    suite.Add("PhysicsQuery::CastBatch 1k", QUERIES, [data] {
+        PhysicsQuery::CastBatch(data->commands.data(), data->results.data(), data->commands.size());
+        Bench::DoNotOptimize(data->results.data());
+    });
+}
+
+// ============ Sprite culling ============
+
+void AddCullingBenchmarks(Bench::Suite& suite) {
+    constexpr float SCREEN_WIDTH = 1280.0f;
+    constexpr float SCREEN_HEIGHT = 720.0f;
+    constexpr float LEVEL_SCALE = 20.0f;
+    constexpr size_t STATIC_SPRITES = 20000;
+    constexpr size_t MOVING_SPRITES = 500;
+    constexpr size_t VIEWS = 64;
+
+    // Only this fixture's sprites: forget the ones the fixtures above registered
+    SpriteCuller::Get().Clear();
+
+    // A level 20 screens wide and high, viewed one screen at a time
+    struct Data {
+        std::vector<std::shared_ptr<GameObject>> objects;
+        std::vector<AABB> views;
+    };
+    auto data = std::make_shared<Data>();
+    float levelWidth = SCREEN_WIDTH * LEVEL_SCALE;
+    float levelHeight = SCREEN_HEIGHT * LEVEL_SCALE;
+    for (size_t i = 0; i < STATIC_SPRITES + MOVING_SPRITES; i++) {
+        auto obj = std::make_shared<GameObject>("Sprite " + std::to_string(i));
+        obj->AddComponent<Transform>(RandomFloat(0, levelWidth), RandomFloat(0, levelHeight));
+        auto sprite = obj->AddComponent<SpriteRenderer>();
+        sprite->SetSize(RandomFloat(16, 128), RandomFloat(16, 128));
+        sprite->SetStatic(i < STATIC_SPRITES);
+        data->objects.push_back(obj);
+    }
+    for (size_t i = 0; i < VIEWS; i++) {
+        data->views.emplace_back(RandomFloat(0, levelWidth - SCREEN_WIDTH), RandomFloat(0, levelHeight - SCREEN_HEIGHT),
+                                 SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    suite.Add("SpriteCuller::Cull 20k static + 500 moving", VIEWS, [data] {
+        size_t visible = 0;
+        for (const AABB& view : data->views) {
+            SpriteCuller::Get().Cull(view);
+            visible += SpriteCuller::Get().GetVisible().size();
+        }
+        Bench::DoNotOptimize(visible);
+    });
+
+    // What every frame paid before: all sprites collected and ordered
+    suite.Add("SpriteCuller::Cull disabled 20.5k", VIEWS, [data] {
+        SpriteCuller::Get().SetEnabled(false);
+        size_t visible = 0;
+        for (const AABB& view : data->views) {
+            SpriteCuller::Get().Cull(view);
+            visible += SpriteCuller::Get().GetVisible().size();
+        }
+        SpriteCuller::Get().SetEnabled(true);
+        Bench::DoNotOptimize(visible);
+    });
+}
+
+// ============ Render queue ============
+
+void AddRenderQueueBenchmarks(Bench::Suite& suite) {
+    constexpr size_t SPRITES = 100000;
+
+    // A frame's worth of sprites over a few layers, orders and textures
+    struct Data {
+        std::vector<Sprite> sprites;
+        std::vector<Texture*> textures;
+        std::vector<int> layers;
+        std::vector<int> orders;
+        std::vector<uint64_t> keys;
+    };
+    auto data = std::make_shared<Data>();
+    for (size_t i = 0; i < SPRITES; i++) {
+        Sprite sprite;
+        sprite.SetPosition(RandomFloat(0, 1280), RandomFloat(0, 720));
+        sprite.SetSize(32.0f, 32.0f);
+        data->sprites.push_back(sprite);
+        data->layers.push_back(static_cast<int>(g_random() % 4));
+        data->orders.push_back(static_cast<int>(g_random() % 64) - 32);
+        data->keys.push_back(RenderQueue::MakeKey(data->layers.back(), data->orders.back(), 0,
+                                                  static_cast<uint16_t>(g_random() % 16),
+                                                  static_cast<uint16_t>(i)));
+    }
+
+    suite.Add("RenderQueue::Submit+Sort 100k", SPRITES, [data] {
+        RenderQueue& queue = RenderQueue::Get();
+        for (size_t i = 0; i < SPRITES; i++) {
+            queue.Submit(data->sprites[i], data->layers[i], data->orders[i], static_cast<uint16_t>(i));
+        }
+        queue.Sort();
+        Bench::DoNotOptimize(queue.GetSortedIndex(0));
+        queue.Clear();
+    });
+
+    // Comparison sort of the same keys
+    auto keys = std::make_shared<std::vector<uint64_t>>();
+    suite.Add("std::stable_sort 100k keys", SPRITES, [data, keys] {
+        *keys = data->keys;
+        std::stable_sort(keys->begin(), keys->end());
+        Bench::DoNotOptimize(keys->data());
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Bench::Options options;
+    if (!options.Parse(argc, argv)) {
+        return 1;
+    }
+
+    RenderBackend::SetNull(true);
+
+    Bench::Suite suite;
+    AddCollisionBenchmarks(suite);
+    AddTilemapBenchmarks(suite);
+    AddQueryBenchmarks(suite);      // Steps the PhysicsWorld: before fixtures that stack colliders
+    AddParticleBenchmarks(suite);
+    AddTransformBenchmarks(suite);
+    AddGameObjectBenchmarks(suite);
+    AddSceneBenchmarks(suite);
+    AddTextBenchmarks(suite);
+    AddRenderQueueBenchmarks(suite);
+    AddCullingBenchmarks(suite);    // Clears SpriteCuller: after fixtures that add sprites
+
+    return suite.Run(options);
+}
@@ -0,0 +1,147 @@
+// Particle update microbenchmark: compares the SoA pool + SIMD kernel used by
+// ParticleEmitter against the previous array-of-structs implementation.
+//
+// Usage: particle_bench [particleCount] [frames]
+
+#include "../src/Particle.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// ============ Legacy AoS reference ============
+
+namespace Legacy {
+
+struct Particle {
+    float x, y;
+    float vx, vy;
+    float size;
+    float rotation;
+    float rotationSpeed;
+    float life;
+    float maxLife;
+    float r, g, b, a;
+    bool active;
+};
+
+struct Emitter {
+    ParticleConfig config;
+    std::vector<Particle> particles;
+
+    float RandomFloat(float min, float max) {
+        return min + static_cast<float>(rand()) / (static_cast<float>(RAND_MAX / (max - min)));
+    }
+
+    void Burst(int count) {
+        for (int n = 0; n < count; n++) {
+            for (auto& p : particles) {
+                if (p.active) continue;
+                float angle = RandomFloat(config.minAngle, config.maxAngle);
+                float speed = RandomFloat(config.minSpeed, config.maxSpeed);
+                p.x = 0; p.y = 0;
+                p.vx = cos(angle) * speed;
+                p.vy = sin(angle) * speed;
+                p.size = config.startSize;
+                p.rotation = 0;
+                p.rotationSpeed = RandomFloat(config.minRotationSpeed, config.maxRotationSpeed);
+                p.maxLife = RandomFloat(config.minLife, config.maxLife);
+                p.life = p.maxLife;
+                p.r = config.startR; p.g = config.startG; p.b = config.startB; p.a = config.startA;
+                p.active = true;
+                break;
+            }
+        }
+    }
+
+    void Update(float dt) {
+        for (auto& p : particles) {
+            if (!p.active) continue;
+
+            p.life -= dt;
+            if (p.life <= 0) {
+                p.active = false;
+                continue;
+            }
+
+            float lifeRatio = p.life / p.maxLife;
+            float deathRatio = 1.0f - lifeRatio;
+
+            p.vx += config.gravityX * dt;
+            p.vy += config.gravityY * dt;
+            p.x += p.vx * dt;
+            p.y += p.vy * dt;
+            p.rotation += p.rotationSpeed * dt;
+
+            p.size = config.startSize * lifeRatio + config.endSize * deathRatio;
+            p.r = config.startR * lifeRatio + config.endR * deathRatio;
+            p.g = config.startG * lifeRatio + config.endG * deathRatio;
+            p.b = config.startB * lifeRatio + config.endB * deathRatio;
+            p.a = config.startA * lifeRatio + config.endA * deathRatio;
+        }
+    }
+};
+
+} // namespace Legacy
+
+// ============ Benchmark ============
+
+static ParticleConfig MakeConfig(int count) {
+    ParticleConfig config = ParticlePresets::Spark();
+    config.maxParticles = count;
+    config.spawnRate = 0.0f;
+    // Long enough that nothing dies during the run
+    config.minLife = 1000.0f;
+    config.maxLife = 1000.0f;
+    config.gravityY = 98.0f;
+    return config;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? atoi(argv[1]) : 100000;
+    int frames = argc > 2 ? atoi(argv[2]) : 200;
+    const float dt = 1.0f / 60.0f;
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Legacy: the linear free-slot scan makes a full burst O(n^2), so fill it directly
+    Legacy::Emitter legacy;
+    legacy.config = MakeConfig(count);
+    legacy.particles.resize(count);
+    for (auto& p : legacy.particles) p.active = false;
+    legacy.Burst(1);
+    for (auto& p : legacy.particles) p = legacy.particles[0];
+
+    ParticleEmitter emitter;
+    emitter.SetConfig(MakeConfig(count));
+    emitter.Burst(count);
+
+    // Warm up caches and branch predictors
+    for (int i = 0; i < 10; i++) {
+        legacy.Update(dt);
+        emitter.Update(dt);
+    }
+
+    auto start = Clock::now();
+    for (int i = 0; i < frames; i++) legacy.Update(dt);
+    double legacyMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+    start = Clock::now();
+    for (int i = 0; i < frames; i++) emitter.Update(dt);
+    double soaMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+#if defined(__AVX__)
+    const char* kernel = "AVX";
+#elif defined(__SSE2__) || defined(_M_X64)
+    const char* kernel = "SSE2";
+#else
+    const char* kernel = "scalar";
+#endif
+
+    printf("Particles: %d, frames: %d, kernel: %s\n", emitter.GetActiveCount(), frames, kernel);
+    printf("  AoS (legacy) : %8.3f ms/update\n", legacyMs);
+    printf("  SoA + SIMD   : %8.3f ms/update\n", soaMs);
+    printf("  Speedup      : %8.2fx\n", legacyMs / soaMs);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Scene load microbenchmark: builds a scene of GameObjects with Transform,
+// SpriteRenderer and (every other object) BoxCollider2D, saves it as JSON and
+// as .mscene, then times SceneSerializer::LoadScene on both files.
+//
+// Usage: scene_bench [objects] [runs]
+
+#include "../src/Core/SceneSerializer.h"
+#include "../src/ECS/GameObject.h"
+#include "../src/ECS/Components/Transform.h"
+#include "../src/ECS/Components/SpriteRenderer.h"
+#include "../src/ECS/Components/BoxCollider2D.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static double TimeLoad(const std::string& path, int runs, size_t& objectCount) {
+    double best = 1e30;
+    for (int run = 0; run < runs; run++) {
+        std::vector<std::shared_ptr<GameObject>> objects;
+
+        auto start = std::chrono::steady_clock::now();
+        SceneSerializer::LoadScene(path, objects);
+        auto end = std::chrono::steady_clock::now();
+
+        objectCount = objects.size();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    int objectCount = argc > 1 ? std::atoi(argv[1]) : 50000;
+    int runs = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    std::string jsonPath = (fs::temp_directory_path() / "molga_scene_bench.json").string();
+    std::string binaryPath = (fs::temp_directory_path() / "molga_scene_bench.mscene").string();
+
+    // The serializer logs every load; keep the benchmark output readable
+    std::ostringstream discard;
+    std::streambuf* coutBuffer = std::cout.rdbuf(discard.rdbuf());
+
+    {
+        std::vector<std::shared_ptr<GameObject>> objects;
+        objects.reserve(objectCount);
+        for (int i = 0; i < objectCount; i++) {
+            auto obj = std::make_shared<GameObject>("Object_" + std::to_string(i));
+            Transform* transform = obj->AddComponent<Transform>();
+            transform->SetPosition(static_cast<float>(i % 1000) * 16.0f, static_cast<float>(i / 1000) * 16.0f);
+            transform->SetRotation(static_cast<float>(i % 360));
+
+            SpriteRenderer* sprite = obj->AddComponent<SpriteRenderer>();
+            sprite->SetColor(1.0f, 0.5f, 0.25f, 1.0f);
+            sprite->SetTexturePath("assets/sprite_" + std::to_string(i % 64) + ".png");
+            sprite->SetSortingOrder(i % 8);
+
+            if (i % 2 == 0) {
+                obj->AddComponent<BoxCollider2D>()->SetSize(16.0f, 16.0f);
+            }
+            objects.push_back(obj);
+        }
+
+        SceneSerializer::SaveScene(jsonPath, objects);
+        SceneSerializer::SaveScene(binaryPath, objects);
+    }
+
+    size_t jsonObjects = 0;
+    size_t binaryObjects = 0;
+    double jsonMs = TimeLoad(jsonPath, runs, jsonObjects);
+    double binaryMs = TimeLoad(binaryPath, runs, binaryObjects);
+
+    std::cout.rdbuf(coutBuffer);
+
+    std::printf("Scene load: %d objects, best of %d runs\n", objectCount, runs);
+    std::printf("  JSON    %8.2f ms  %8.1f KB  (%zu objects)\n",
+                jsonMs, fs::file_size(jsonPath) / 1024.0, jsonObjects);
+    std::printf("  mscene  %8.2f ms  %8.1f KB  (%zu objects)\n",
+                binaryMs, fs::file_size(binaryPath) / 1024.0, binaryObjects);
+    std::printf("  speedup %.1fx\n", jsonMs / binaryMs);
+
+    fs::remove(jsonPath);
+    fs::remove(binaryPath);
+    return 0;
+}
@@ -0,0 +1,136 @@
+// World transform microbenchmark: 1000 chains of 10 nested GameObjects
+// (10k transforms). Each frame every root moves and every node's world
+// position/rotation/scale is read, as SpriteRenderer::RenderSprite does.
+// Compares the cached transforms against the previous recursive getters.
+//
+// Usage: transform_bench [chains] [depth] [frames]
+
+#include "../src/ECS/GameObject.h"
+#include "../src/ECS/Components/Transform.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// ============ Legacy recursive getters ============
+
+namespace Legacy {
+
+Vector2 GetWorldScale(const Transform* t);
+float GetWorldRotation(const Transform* t);
+
+const Transform* GetParent(const Transform* t) {
+    GameObject* parent = t->GetGameObject()->GetParent();
+    return parent ? parent->GetComponent<Transform>() : nullptr;
+}
+
+Vector2 GetWorldPosition(const Transform* t) {
+    Vector2 position = t->GetPosition();
+    Vector2 worldPos = position;
+
+    const Transform* parent = GetParent(t);
+    if (parent) {
+        Vector2 parentWorldPos = GetWorldPosition(parent);
+        Vector2 parentScale = GetWorldScale(parent);
+        float parentRot = GetWorldRotation(parent);
+
+        float scaledX = position.x * parentScale.x;
+        float scaledY = position.y * parentScale.y;
+
+        float radians = parentRot * 3.14159265f / 180.0f;
+        float cosA = std::cos(radians);
+        float sinA = std::sin(radians);
+
+        worldPos.x = scaledX * cosA - scaledY * sinA + parentWorldPos.x;
+        worldPos.y = scaledX * sinA + scaledY * cosA + parentWorldPos.y;
+    }
+    return worldPos;
+}
+
+float GetWorldRotation(const Transform* t) {
+    const Transform* parent = GetParent(t);
+    return t->GetRotation() + (parent ? GetWorldRotation(parent) : 0.0f);
+}
+
+Vector2 GetWorldScale(const Transform* t) {
+    Vector2 worldScale = t->GetScale();
+    const Transform* parent = GetParent(t);
+    if (parent) {
+        Vector2 parentScale = GetWorldScale(parent);
+        worldScale.x *= parentScale.x;
+        worldScale.y *= parentScale.y;
+    }
+    return worldScale;
+}
+
+} // namespace Legacy
+
+// ============ Benchmark ============
+
+int main(int argc, char** argv) {
+    int chains = argc > 1 ? atoi(argv[1]) : 1000;
+    int depth = argc > 2 ? atoi(argv[2]) : 10;
+    int frames = argc > 3 ? atoi(argv[3]) : 100;
+
+    std::vector<std::unique_ptr<GameObject>> objects;
+    std::vector<Transform*> roots;
+    std::vector<Transform*> transforms;
+
+    for (int c = 0; c < chains; c++) {
+        GameObject* parent = nullptr;
+        for (int d = 0; d < depth; d++) {
+            objects.push_back(std::make_unique<GameObject>("Node"));
+            GameObject* obj = objects.back().get();
+            Transform* transform = obj->AddComponent<Transform>(10.0f, 0.0f);
+            transform->SetRotation(5.0f);
+            transform->SetScale(1.01f);
+            if (parent) {
+                obj->SetParent(parent);
+            } else {
+                roots.push_back(transform);
+            }
+            transforms.push_back(transform);
+            parent = obj;
+        }
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    float checksum = 0.0f;
+
+    auto start = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (Transform* root : roots) root->Translate(1.0f, 0.0f);
+        for (const Transform* t : transforms) {
+            Vector2 pos = Legacy::GetWorldPosition(t);
+            Vector2 scale = Legacy::GetWorldScale(t);
+            checksum += pos.x + scale.x + Legacy::GetWorldRotation(t);
+        }
+    }
+    double legacyMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+    float legacyChecksum = checksum;
+    checksum = 0.0f;
+    for (Transform* root : roots) root->Translate(-1.0f * frames, 0.0f);
+
+    start = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (Transform* root : roots) root->Translate(1.0f, 0.0f);
+        Transform::UpdateWorldTransforms();
+        for (const Transform* t : transforms) {
+            Vector2 pos = t->GetWorldPosition();
+            Vector2 scale = t->GetWorldScale();
+            checksum += pos.x + scale.x + t->GetWorldRotation();
+        }
+    }
+    double cachedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+    printf("Transforms: %zu (%d chains x depth %d), frames: %d\n", transforms.size(), chains, depth, frames);
+    printf("  Recursive (legacy) : %8.3f ms/frame\n", legacyMs);
+    printf("  Cached + dirty     : %8.3f ms/frame\n", cachedMs);
+    printf("  Speedup            : %8.2fx\n", legacyMs / cachedMs);
+    printf("  Checksums          : %g / %g\n", legacyChecksum, checksum);
+
+    return 0;
+}
@@ -1,15 +1,172 @@
 #define MINIAUDIO_IMPLEMENTATION
 #include "../external/miniaudio/miniaudio.h"
 #include "Audio.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <vector>
+
+// ============ Voice pool ============
+
+// Fully decoded sound effect: interleaved float frames in the engine's
+// channel count and sample rate, so voices mix it without conversion
+struct AudioClip {
+    float* frames = nullptr;
+    ma_uint64 frameCount = 0;
+
+    ~AudioClip() {
+        ma_free(frames, nullptr);
+    }
+};
+
+struct VoiceCommand {
+    enum Type : uint8_t { Play, Stop };
+
+    Type type;
+    const AudioClip* clip;              // Play only
+    uint32_t sound;                     // Id of the name played or stopped
+    float volume;
+    int priority;
+};
+
+struct Voice {
+    const AudioClip* clip = nullptr;    // Null when free
+    uint32_t sound = 0;                 // Name the voice was started under
+    ma_uint64 cursor = 0;               // Next frame
+    float volume = 0.0f;
+    int priority = 0;
+    uint64_t order = 0;                 // Start order, for stealing the oldest
+};
+
+// Node graph source that mixes every playing voice. The main thread only
+// pushes commands into a single-producer / single-consumer ring; the voices
+// themselves are owned by the audio thread.
+struct VoiceMixer {
+    static constexpr size_t QUEUE_SIZE = 1024;
+
+    ma_node_base base;                  // Must be first: miniaudio casts ma_node* to this
+    ma_uint32 channels = 2;
+    std::vector<Voice> voices;
+    uint64_t nextOrder = 0;
+
+    VoiceCommand queue[QUEUE_SIZE];
+    std::atomic<size_t> head{0};        // Written by the main thread
+    std::atomic<size_t> tail{0};        // Written by the audio thread
+
+    std::atomic<int> activeVoices{0};
+    std::atomic<uint64_t> stolenVoices{0};
+    std::atomic<uint64_t> droppedSounds{0};
+
+    // Main thread
+    bool Push(const VoiceCommand& command) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= QUEUE_SIZE) return false;
+
+        queue[h % QUEUE_SIZE] = command;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Audio thread
+    void Apply(const VoiceCommand& command) {
+        if (command.type == VoiceCommand::Stop) {
+            for (Voice& voice : voices) {
+                if (voice.sound == command.sound) voice.clip = nullptr;
+            }
+            return;
+        }
+
+        // A free voice, else the lowest priority one, quietest then oldest
+        Voice* target = nullptr;
+        for (Voice& voice : voices) {
+            if (!voice.clip) {
+                target = &voice;
+                break;
+            }
+            if (!target || voice.priority < target->priority ||
+                (voice.priority == target->priority &&
+                 (voice.volume < target->volume ||
+                  (voice.volume == target->volume && voice.order < target->order)))) {
+                target = &voice;
+            }
+        }
+        if (!target) return;
+
+        if (target->clip) {
+            if (target->priority > command.priority) {
+                droppedSounds.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            stolenVoices.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        target->clip = command.clip;
+        target->sound = command.sound;
+        target->cursor = 0;
+        target->volume = command.volume;
+        target->priority = command.priority;
+        target->order = nextOrder++;
+    }
+
+    void Mix(float* out, ma_uint32 frameCount) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t h = head.load(std::memory_order_acquire);
+        for (; t != h; t++) {
+            Apply(queue[t % QUEUE_SIZE]);
+        }
+        tail.store(t, std::memory_order_release);
+
+        std::fill(out, out + frameCount * channels, 0.0f);
+
+        int active = 0;
+        for (Voice& voice : voices) {
+            if (!voice.clip) continue;
+
+            ma_uint64 remaining = voice.clip->frameCount - voice.cursor;
+            ma_uint32 frames = remaining < frameCount ? static_cast<ma_uint32>(remaining) : frameCount;
+            const float* src = voice.clip->frames + voice.cursor * channels;
+            float volume = voice.volume;
+            for (ma_uint32 i = 0; i < frames * channels; i++) {
+                out[i] += src[i] * volume;
+            }
+
+            voice.cursor += frames;
+            if (voice.cursor >= voice.clip->frameCount) {
+                voice.clip = nullptr;
+            } else {
+                active++;
+            }
+        }
+        activeVoices.store(active, std::memory_order_relaxed);
+    }
+};
+
+namespace {
+
+void ProcessVoiceMixer(ma_node* node, const float**, ma_uint32*, float** framesOut, ma_uint32* frameCountOut) {
+    reinterpret_cast<VoiceMixer*>(node)->Mix(framesOut[0], *frameCountOut);
+}
+
+ma_node_vtable g_voiceMixerVTable = {
+    ProcessVoiceMixer,
+    nullptr,    // onGetRequiredInputFrameCount
+    0,          // No input buses
+    1,          // One output bus
+    0
+};
+
+} // namespace
 
 ma_engine* Audio::engine = nullptr;
 ma_sound* Audio::musicSound = nullptr;
-std::unordered_map<std::string, ma_sound*> Audio::sounds;
+VoiceMixer* Audio::mixer = nullptr;
+std::unordered_map<std::string, std::unique_ptr<AudioClip>> Audio::clips;
+std::unordered_map<std::string, Audio::SoundEntry> Audio::sounds;
+uint32_t Audio::nextSoundId = 0;
 float Audio::masterVolume = 1.0f;
 bool Audio::initialized = false;
 
-bool Audio::Init() {
+bool Audio::Init(int voiceCount) {
     if (initialized) return true;
 
     engine = new ma_engine();
@@ -20,6 +177,26 @@ bool Audio::Init() {
         return false;
     }
 
+    // Every voice is preallocated; nothing is allocated while playing
+    mixer = new VoiceMixer();
+    mixer->channels = ma_engine_get_channels(engine);
+    mixer->voices.resize(voiceCount > 0 ? voiceCount : 1);
+
+    ma_node_config nodeConfig = ma_node_config_init();
+    nodeConfig.vtable = &g_voiceMixerVTable;
+    nodeConfig.pOutputChannels = &mixer->channels;
+    bool nodeReady = ma_node_init(ma_engine_get_node_graph(engine), &nodeConfig, nullptr, &mixer->base) == MA_SUCCESS;
+    if (!nodeReady || ma_node_attach_output_bus(&mixer->base, 0, ma_engine_get_endpoint(engine), 0) != MA_SUCCESS) {
+        std::cerr << "Failed to initialize audio voice pool" << std::endl;
+        if (nodeReady) ma_node_uninit(&mixer->base, nullptr);
+        delete mixer;
+        mixer = nullptr;
+        ma_engine_uninit(engine);
+        delete engine;
+        engine = nullptr;
+        return false;
+    }
+
     initialized = true;
     return true;
 }
@@ -27,11 +204,11 @@ bool Audio::Init() {
 void Audio::Shutdown() {
     if (!initialized) return;
 
-    // Stop and free all sounds
-    for (auto& pair : sounds) {
-        ma_sound_uninit(pair.second);
-        delete pair.second;
-    }
+    // Detach the voice pool from the audio thread before freeing the clips
+    // it reads
+    ma_node_uninit(&mixer->base, nullptr);
+    delete mixer;
+    mixer = nullptr;
     sounds.clear();
 
     // Stop and free music
@@ -48,40 +225,51 @@ void Audio::Shutdown() {
         engine = nullptr;
     }
 
+    clips.clear();
     initialized = false;
 }
 
 bool Audio::LoadSound(const std::string& name, const std::string& filepath) {
     if (!initialized) return false;
 
-    // Remove existing sound with same name
-    auto it = sounds.find(name);
-    if (it != sounds.end()) {
-        ma_sound_uninit(it->second);
-        delete it->second;
-        sounds.erase(it);
+    // A reloaded name keeps its id, so StopSound still reaches voices
+    // started with its previous clip
+    auto existing = sounds.find(name);
+    uint32_t id = existing != sounds.end() ? existing->second.id : nextSoundId++;
+
+    // Names aliasing a path share its decoded clip
+    auto cached = clips.find(filepath);
+    if (cached != clips.end()) {
+        sounds[name] = { cached->second.get(), id };
+        return true;
     }
 
-    ma_sound* sound = new ma_sound();
-    if (ma_sound_init_from_file(engine, filepath.c_str(), 0, nullptr, nullptr, sound) != MA_SUCCESS) {
+    auto clip = std::make_unique<AudioClip>();
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, ma_engine_get_channels(engine),
+                                                      ma_engine_get_sample_rate(engine));
+    void* frames = nullptr;
+    if (ma_decode_file(filepath.c_str(), &config, &clip->frameCount, &frames) != MA_SUCCESS) {
         std::cerr << "Failed to load sound: " << filepath << std::endl;
-        delete sound;
         return false;
     }
+    clip->frames = static_cast<float*>(frames);
 
-    sounds[name] = sound;
+    // Replacing a name leaves its old clip cached: voices may still play it
+    sounds[name] = { clip.get(), id };
+    clips[filepath] = std::move(clip);
     return true;
 }
 
-void Audio::PlaySound(const std::string& name, float volume) {
+void Audio::PlaySound(const std::string& name, float volume, int priority) {
     if (!initialized) return;
 
     auto it = sounds.find(name);
     if (it == sounds.end()) return;
 
-    ma_sound_set_volume(it->second, volume * masterVolume);
-    ma_sound_seek_to_pcm_frame(it->second, 0);
-    ma_sound_start(it->second);
+    // Master volume is applied by the engine
+    if (!mixer->Push({ VoiceCommand::Play, it->second.clip, it->second.id, volume, priority })) {
+        mixer->droppedSounds.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 void Audio::StopSound(const std::string& name) {
@@ -89,10 +277,22 @@ void Audio::StopSound(const std::string& name) {
 
     auto it = sounds.find(name);
     if (it != sounds.end()) {
-        ma_sound_stop(it->second);
+        mixer->Push({ VoiceCommand::Stop, nullptr, it->second.id, 0.0f, 0 });
     }
 }
 
+int Audio::GetActiveVoiceCount() {
+    return mixer ? mixer->activeVoices.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t Audio::GetStolenVoiceCount() {
+    return mixer ? mixer->stolenVoices.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t Audio::GetDroppedSoundCount() {
+    return mixer ? mixer->droppedSounds.load(std::memory_order_relaxed) : 0;
+}
+
 bool Audio::LoadMusic(const std::string& filepath) {
     if (!initialized) return false;
 
@@ -141,7 +341,8 @@ void Audio::ResumeMusic() {
 
 void Audio::SetMusicVolume(float volume) {
     if (!initialized || !musicSound) return;
-    ma_sound_set_volume(musicSound, volume * masterVolume);
+    // Master volume is applied by the engine
+    ma_sound_set_volume(musicSound, volume);
 }
 
 bool Audio::IsMusicPlaying() {
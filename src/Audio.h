@@ -1,22 +1,48 @@
 #ifndef MOLGA_AUDIO_H
 #define MOLGA_AUDIO_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 struct ma_engine;
 struct ma_sound;
+struct AudioClip;
+struct VoiceMixer;
 
 class Audio {
 public:
-    static bool Init();
+    static constexpr int DEFAULT_VOICE_COUNT = 64;
+
+    // voiceCount: sound effects that can play at once
+    static bool Init(int voiceCount = DEFAULT_VOICE_COUNT);
     static void Shutdown();
 
-    // Sound effects
+    // Sound effects. A file is decoded once to PCM in the engine's format
+    // and shared by every name loaded from the same path; clips stay cached
+    // until Shutdown. Each PlaySound starts its own voice, so repeated
+    // effects overlap instead of restarting.
+    //
+    // Voices are mixed on the audio thread and driven through a lock-free
+    // command queue, so PlaySound/StopSound never block on it. Call them
+    // from the main thread only (the queue has a single producer).
     static bool LoadSound(const std::string& name, const std::string& filepath);
-    static void PlaySound(const std::string& name, float volume = 1.0f);
+
+    // When every voice is busy the lowest priority voice is stolen (the
+    // quietest, then the oldest, among equals). If all of them outrank the
+    // new sound, it is dropped.
+    static void PlaySound(const std::string& name, float volume = 1.0f, int priority = 0);
+
+    // Stops every voice started under this name. Other names loaded from
+    // the same file keep playing.
     static void StopSound(const std::string& name);
 
+    // Voice pool statistics, updated by the audio thread
+    static int GetActiveVoiceCount();
+    static uint64_t GetStolenVoiceCount();
+    static uint64_t GetDroppedSoundCount();
+
     // Music (streaming)
     static bool LoadMusic(const std::string& filepath);
     static void PlayMusic(bool loop = true);
@@ -31,9 +57,18 @@ public:
     static float GetMasterVolume();
 
 private:
+    // A loaded name: its clip and the id its voices are tagged with
+    struct SoundEntry {
+        const AudioClip* clip;
+        uint32_t id;
+    };
+
     static ma_engine* engine;
     static ma_sound* musicSound;
-    static std::unordered_map<std::string, ma_sound*> sounds;
+    static VoiceMixer* mixer;
+    static std::unordered_map<std::string, std::unique_ptr<AudioClip>> clips;  // By file path
+    static std::unordered_map<std::string, SoundEntry> sounds;                 // By name
+    static uint32_t nextSoundId;
     static float masterVolume;
     static bool initialized;
 };
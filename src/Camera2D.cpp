@@ -83,3 +83,19 @@ void Camera2D::GetProjectionMatrix(mat4x4 out) {
     UpdateMatrices();
     mat4x4_dup(out, projectionMatrix);
 }
+
+AABB Camera2D::GetWorldBounds() const {
+    // The view maps world point p to C + zoom * R * (p - C - pos), where C is
+    // the screen center, so the screen center sees world point pos + C
+    float centerX = x + screenWidth / 2.0f;
+    float centerY = y + screenHeight / 2.0f;
+
+    float radians = rotation * (float)M_PI / 180.0f;
+    float c = std::fabs(std::cos(radians));
+    float s = std::fabs(std::sin(radians));
+
+    float halfW = (c * screenWidth + s * screenHeight) / (2.0f * zoom);
+    float halfH = (s * screenWidth + c * screenHeight) / (2.0f * zoom);
+
+    return AABB(centerX - halfW, centerY - halfH, halfW * 2.0f, halfH * 2.0f);
+}
@@ -2,6 +2,7 @@
 #define MOLGA_CAMERA2D_H
 
 #include "linmath.h"
+#include "Common/Types.h"
 
 class Camera2D {
 public:
@@ -21,6 +22,10 @@ public:
     float GetZoom() const { return zoom; }
     float GetRotation() const { return rotation; }
 
+    // World-space rectangle covering everything visible on screen
+    // (the bounding box of the rotated view when rotation != 0)
+    AABB GetWorldBounds() const;
+
     void SetScreenSize(float width, float height);
 
 private:
@@ -0,0 +1,25 @@
+#ifndef MOLGA_PATH_UTIL_H
+#define MOLGA_PATH_UTIL_H
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+namespace PathUtil {
+
+// Absolute, lexically normalized, no trailing separator. The form
+// AssetWatcher reports changes in; use it wherever a path is compared
+// with one held elsewhere (shader sources, texture files, scenes).
+inline std::string Normalize(const std::string& path) {
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(path, error);
+    std::string normalized = (error ? std::filesystem::path(path) : absolute).lexically_normal().string();
+    while (normalized.size() > 1 && normalized.back() == '/') {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+} // namespace PathUtil
+
+#endif // MOLGA_PATH_UTIL_H
@@ -0,0 +1,60 @@
+#ifndef MOLGA_UTF8_H
+#define MOLGA_UTF8_H
+
+#include <cstdint>
+
+namespace Utf8 {
+
+// Substituted for malformed sequences
+constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+// Decode the code point at it and advance it past it. Malformed input
+// decodes to REPLACEMENT: an invalid lead byte, a truncated sequence or a
+// missing continuation byte consumes one byte; a well-formed sequence that
+// encodes an overlong form, a surrogate or a value above U+10FFFF consumes
+// its full length. Either way a bad string lays out in bounded steps.
+inline uint32_t Decode(const char*& it, const char* end) {
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(it);
+    unsigned char lead = s[0];
+
+    if (lead < 0x80) {
+        it += 1;
+        return lead;
+    }
+
+    int length;
+    uint32_t codepoint;
+    uint32_t minimum;
+    if ((lead & 0xE0) == 0xC0) {
+        length = 2; codepoint = lead & 0x1F; minimum = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3; codepoint = lead & 0x0F; minimum = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4; codepoint = lead & 0x07; minimum = 0x10000;
+    } else {
+        it += 1;
+        return REPLACEMENT;
+    }
+
+    if (end - it < length) {
+        it += 1;
+        return REPLACEMENT;
+    }
+    for (int i = 1; i < length; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            it += 1;
+            return REPLACEMENT;
+        }
+        codepoint = (codepoint << 6) | (s[i] & 0x3F);
+    }
+
+    it += length;
+    if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+        return REPLACEMENT;
+    }
+    return codepoint;
+}
+
+} // namespace Utf8
+
+#endif // MOLGA_UTF8_H
@@ -0,0 +1,293 @@
+#include "AssetWatcher.h"
+#include "Profiler.h"
+#include "../Common/PathUtil.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+
+#ifdef __linux__
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+namespace fs = std::filesystem;
+
+#ifdef __linux__
+namespace {
+
+// Writes are reported twice (IN_MODIFY per chunk, IN_CLOSE_WRITE at the
+// end); the repeated events only push the debounce deadline back
+constexpr uint32_t WATCH_MASK = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO |
+                                IN_DELETE | IN_ONLYDIR;
+
+} // namespace
+#endif
+
+AssetWatcher& AssetWatcher::Get() {
+    static AssetWatcher instance;
+    return instance;
+}
+
+AssetWatcher::~AssetWatcher() {
+    Stop();
+}
+
+bool AssetWatcher::Watch(const std::string& directory, bool recursive) {
+    std::string path = PathUtil::Normalize(directory);
+
+    std::error_code error;
+    if (!fs::is_directory(path, error)) {
+        std::cerr << "[AssetWatcher] Not a directory: " << path << std::endl;
+        return false;
+    }
+
+#ifdef __linux__
+    if (notifyFd < 0) {
+        notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notifyFd < 0) {
+            std::cerr << "[AssetWatcher] inotify_init1 failed (errno " << errno << ")" << std::endl;
+            return false;
+        }
+        if (pipe2(wakeFd, O_NONBLOCK | O_CLOEXEC) != 0) {
+            std::cerr << "[AssetWatcher] pipe2 failed (errno " << errno << ")" << std::endl;
+            close(notifyFd);
+            notifyFd = -1;
+            return false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!AddWatch(path, recursive, false)) {
+            return false;
+        }
+    }
+
+    if (!thread.joinable()) {
+        thread = std::thread(&AssetWatcher::ThreadLoop, this);
+    }
+
+    std::cout << "[AssetWatcher] Watching " << path << " (" << GetWatchCount() << " directories)" << std::endl;
+    return true;
+#else
+    (void)recursive;
+    std::cerr << "[AssetWatcher] File watching is not supported on this platform" << std::endl;
+    return false;
+#endif
+}
+
+void AssetWatcher::Stop() {
+#ifdef __linux__
+    if (thread.joinable()) {
+        char wake = 1;
+        if (write(wakeFd[1], &wake, 1) < 0) {
+            // The pipe is non-blocking and only needs to be readable
+        }
+        thread.join();
+    }
+
+    if (notifyFd >= 0) {
+        close(notifyFd);
+        notifyFd = -1;
+    }
+    for (int& fd : wakeFd) {
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(mutex);
+    watches.clear();
+    changes.clear();
+}
+
+bool AssetWatcher::IsWatching(const std::string& directory) const {
+    std::string path = PathUtil::Normalize(directory);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& watch : watches) {
+        if (watch.second.path == path) return true;
+    }
+    return false;
+}
+
+size_t AssetWatcher::GetWatchCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return watches.size();
+}
+
+std::vector<AssetChange> AssetWatcher::Poll() {
+    std::vector<AssetChange> ready;
+
+    auto now = std::chrono::steady_clock::now();
+    auto debounce = std::chrono::duration<double, std::milli>(debounceMs);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = changes.begin(); it != changes.end();) {
+            if (now - it->second.lastEvent < debounce) {
+                ++it;
+                continue;
+            }
+            ready.push_back({ it->first, it->second.type, it->second.isDirectory });
+            it = changes.erase(it);
+        }
+    }
+
+    std::sort(ready.begin(), ready.end(), [](const AssetChange& a, const AssetChange& b) {
+        return a.path < b.path;
+    });
+    return ready;
+}
+
+void AssetWatcher::Record(const std::string& path, AssetChangeType type, bool isDirectory) {
+    auto now = std::chrono::steady_clock::now();
+
+    auto it = changes.find(path);
+    if (it == changes.end()) {
+        changes[path] = { type, isDirectory, now };
+        return;
+    }
+
+    PendingChange& change = it->second;
+    if (change.type == AssetChangeType::Created && type == AssetChangeType::Removed) {
+        // Temporary file: never seen by anyone
+        changes.erase(it);
+        return;
+    }
+    if (change.type == AssetChangeType::Removed && type == AssetChangeType::Created) {
+        // Replaced (delete and rewrite, or rename over it)
+        change.type = AssetChangeType::Modified;
+    } else if (!(change.type == AssetChangeType::Created && type == AssetChangeType::Modified)) {
+        change.type = type;
+    }
+    change.isDirectory = isDirectory;
+    change.lastEvent = now;
+}
+
+bool AssetWatcher::AddWatch(const std::string& directory, bool recursive, bool reportFiles) {
+#ifdef __linux__
+    int wd = inotify_add_watch(notifyFd, directory.c_str(), WATCH_MASK);
+    if (wd < 0) {
+        // ENOSPC: raise fs.inotify.max_user_watches
+        std::cerr << "[AssetWatcher] Failed to watch " << directory << " (errno " << errno << ")" << std::endl;
+        return false;
+    }
+
+    // Watching a directory again returns the same descriptor
+    WatchedDirectory& watch = watches[wd];
+    watch.recursive = watch.path == directory ? (watch.recursive || recursive) : recursive;
+    watch.path = directory;
+
+    if (!recursive && !reportFiles) return true;
+
+    std::error_code error;
+    for (fs::directory_iterator it(directory, error), end; !error && it != end; it.increment(error)) {
+        std::error_code statusError;
+        if (it->is_symlink(statusError)) continue;
+
+        std::string child = it->path().string();
+        bool isDirectory = it->is_directory(statusError);
+        if (isDirectory && recursive) {
+            AddWatch(child, true, reportFiles);
+        }
+        // A directory moved or copied in: its contents arrive without events
+        if (reportFiles) {
+            Record(child, AssetChangeType::Created, isDirectory);
+        }
+    }
+    return true;
+#else
+    (void)directory;
+    (void)recursive;
+    (void)reportFiles;
+    return false;
+#endif
+}
+
+void AssetWatcher::ThreadLoop() {
+#ifdef __linux__
+    Profiler::Get().SetThreadName("Asset Watcher");
+
+    while (true) {
+        pollfd fds[2];
+        fds[0] = { notifyFd, POLLIN, 0 };
+        fds[1] = { wakeFd[0], POLLIN, 0 };
+
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "[AssetWatcher] poll failed (errno " << errno << ")" << std::endl;
+            return;
+        }
+        if (fds[1].revents) return;
+        if (fds[0].revents & POLLIN) {
+            ReadEvents();
+        }
+    }
+#endif
+}
+
+void AssetWatcher::ReadEvents() {
+#ifdef __linux__
+    alignas(inotify_event) char buffer[64 * 1024];
+
+    while (true) {
+        ssize_t length = read(notifyFd, buffer, sizeof(buffer));
+        if (length <= 0) return;    // EAGAIN: drained
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(ptr);
+            ptr += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                std::cerr << "[AssetWatcher] Event queue overflowed; some changes were missed" << std::endl;
+                continue;
+            }
+
+            auto watchIt = watches.find(event->wd);
+            if (watchIt == watches.end()) continue;
+
+            // The directory is gone (its parent reports the removal)
+            if (event->mask & IN_IGNORED) {
+                watches.erase(watchIt);
+                continue;
+            }
+            if (event->len == 0) continue;
+
+            std::string path = watchIt->second.path + "/" + event->name;
+            bool recursive = watchIt->second.recursive;
+            bool isDirectory = (event->mask & IN_ISDIR) != 0;
+
+            if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                if (isDirectory && recursive) {
+                    AddWatch(path, true, true);
+                }
+                Record(path, AssetChangeType::Created, isDirectory);
+            } else if (event->mask & (IN_MODIFY | IN_CLOSE_WRITE)) {
+                Record(path, AssetChangeType::Modified, isDirectory);
+            } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                // A directory moved elsewhere keeps its watches under the
+                // old paths; drop them (moved back in, it is watched again)
+                if (isDirectory) {
+                    std::string prefix = path + "/";
+                    for (auto it = watches.begin(); it != watches.end();) {
+                        const std::string& watched = it->second.path;
+                        if (watched == path || watched.compare(0, prefix.size(), prefix) == 0) {
+                            inotify_rm_watch(notifyFd, it->first);
+                            it = watches.erase(it);
+                        } else {
+                            ++it;
+                        }
+                    }
+                }
+                Record(path, AssetChangeType::Removed, isDirectory);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,92 @@
+#ifndef MOLGA_ASSET_WATCHER_H
+#define MOLGA_ASSET_WATCHER_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <chrono>
+
+enum class AssetChangeType {
+    Created,
+    Modified,
+    Removed
+};
+
+struct AssetChange {
+    std::string path;           // In PathUtil::Normalize form
+    AssetChangeType type;
+    bool isDirectory;
+};
+
+// Reports files changed on disk under the watched directories. A background
+// thread reads the kernel's change notifications (inotify on Linux; the
+// watcher is unavailable elsewhere and Watch() returns false) and merges
+// them per path: an editor saving a file through a temporary and a rename,
+// or a tool writing a file in several chunks, comes out as one change.
+// A change is handed out by Poll() once its path has been quiet for the
+// debounce time, so a half-written file is not picked up.
+//
+//   AssetWatcher::Get().Watch(Project::Get().GetAssetsPath());
+//   for (const AssetChange& change : AssetWatcher::Get().Poll()) { ... }
+class AssetWatcher {
+public:
+    static AssetWatcher& Get();
+
+    // Watch a directory (and its subdirectories, which are picked up as they
+    // are created, when recursive). Starts the watcher thread on first use.
+    bool Watch(const std::string& directory, bool recursive = true);
+
+    // Stop watching everything and join the thread; pending changes are dropped
+    void Stop();
+
+    bool IsWatching(const std::string& directory) const;
+    bool IsRunning() const { return thread.joinable(); }
+
+    // Changes whose path has been quiet for the debounce time, sorted by
+    // path. Main thread.
+    std::vector<AssetChange> Poll();
+
+    void SetDebounce(double milliseconds) { debounceMs = milliseconds; }
+    double GetDebounce() const { return debounceMs; }
+
+    // Directories with a kernel watch
+    size_t GetWatchCount() const;
+
+private:
+    AssetWatcher() = default;
+    ~AssetWatcher();
+    AssetWatcher(const AssetWatcher&) = delete;
+    AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+    struct PendingChange {
+        AssetChangeType type;
+        bool isDirectory;
+        std::chrono::steady_clock::time_point lastEvent;
+    };
+
+    struct WatchedDirectory {
+        std::string path;
+        bool recursive;
+    };
+
+    // Watch thread
+    void ThreadLoop();
+    void ReadEvents();
+    bool AddWatch(const std::string& directory, bool recursive, bool reportFiles);     // Mutex held
+    void Record(const std::string& path, AssetChangeType type, bool isDirectory);   // Mutex held
+
+    std::thread thread;
+    int notifyFd = -1;
+    int wakeFd[2] = { -1, -1 };                 // Written by Stop() to end the poll
+
+    // Shared with the watch thread
+    mutable std::mutex mutex;
+    std::unordered_map<int, WatchedDirectory> watches;      // By watch descriptor
+    std::unordered_map<std::string, PendingChange> changes; // By path
+
+    double debounceMs = 100.0;
+};
+
+#endif // MOLGA_ASSET_WATCHER_H
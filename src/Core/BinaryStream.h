@@ -0,0 +1,96 @@
+#ifndef MOLGA_BINARY_STREAM_H
+#define MOLGA_BINARY_STREAM_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Little-endian binary writer used by the .mscene format. Values are stored
+// in native layout, so only trivially copyable types can be written.
+class BinaryWriter {
+public:
+    template<typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryWriter::Write needs a POD type");
+        WriteBytes(&value, sizeof(T));
+    }
+
+    // Length-prefixed string (uint32 length + bytes, no terminator)
+    void WriteString(std::string_view str) {
+        Write(static_cast<uint32_t>(str.size()));
+        WriteBytes(str.data(), str.size());
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    // Pad with zeros up to a multiple of alignment
+    void Align(size_t alignment) {
+        while (buffer.size() % alignment != 0) {
+            buffer.push_back(0);
+        }
+    }
+
+    size_t GetSize() const { return buffer.size(); }
+    const std::vector<uint8_t>& GetBuffer() const { return buffer; }
+    std::vector<uint8_t>& GetBuffer() { return buffer; }
+
+private:
+    std::vector<uint8_t> buffer;
+};
+
+// Reads values back from a memory range (e.g. a memory-mapped file) without
+// copying it. Reading past the end sets the failed flag and returns zeros,
+// so callers can check IsOk() once after a block of reads.
+class BinaryReader {
+public:
+    BinaryReader() = default;
+    BinaryReader(const void* data, size_t size)
+        : data(static_cast<const uint8_t*>(data)), size(size) {}
+
+    template<typename T>
+    T Read() {
+        static_assert(std::is_trivially_copyable<T>::value, "BinaryReader::Read needs a POD type");
+        T value{};
+        if (const uint8_t* src = Take(sizeof(T))) {
+            std::memcpy(&value, src, sizeof(T));
+        }
+        return value;
+    }
+
+    // View into the underlying memory; valid as long as the memory is
+    std::string_view ReadString() {
+        uint32_t length = Read<uint32_t>();
+        const uint8_t* src = Take(length);
+        if (!src) return std::string_view();
+        return std::string_view(reinterpret_cast<const char*>(src), length);
+    }
+
+    // Pointer to the next size bytes, or nullptr if out of range
+    const uint8_t* Take(size_t count) {
+        if (failed || count > size - offset) {
+            failed = true;
+            return nullptr;
+        }
+        const uint8_t* src = data + offset;
+        offset += count;
+        return src;
+    }
+
+    bool IsOk() const { return !failed; }
+    size_t GetOffset() const { return offset; }
+    size_t GetRemaining() const { return size - offset; }
+
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t offset = 0;
+    bool failed = false;
+};
+
+#endif // MOLGA_BINARY_STREAM_H
@@ -1,4 +1,6 @@
 #include "GameBuilder.h"
+#include "SceneSerializer.h"
+#include "Profiler.h"
 #include <fstream>
 #include <iostream>
 #include <filesystem>
@@ -12,6 +14,8 @@ GameBuilder& GameBuilder::Get() {
 }
 
 bool GameBuilder::Build(const BuildSettings& settings) {
+    MOLGA_PROFILE("GameBuilder::Build");
+
     progress = 0.0f;
     lastError.clear();
 
@@ -65,6 +69,8 @@ bool GameBuilder::Build(const BuildSettings& settings) {
 }
 
 bool GameBuilder::CreateOutputDirectory(const std::string& path) {
+    MOLGA_PROFILE("GameBuilder::CreateOutputDirectory");
+
     try {
         if (fs::exists(path)) {
             // Clean existing directory
@@ -79,6 +85,8 @@ bool GameBuilder::CreateOutputDirectory(const std::string& path) {
 }
 
 bool GameBuilder::CopyAssets(const std::string& outputPath) {
+    MOLGA_PROFILE("GameBuilder::CopyAssets");
+
     try {
         std::string assetsPath = "assets";
         std::string destPath = outputPath + "/assets";
@@ -95,6 +103,8 @@ bool GameBuilder::CopyAssets(const std::string& outputPath) {
 }
 
 bool GameBuilder::CopyShaders(const std::string& outputPath) {
+    MOLGA_PROFILE("GameBuilder::CopyShaders");
+
     try {
         std::string shadersPath = "src/Shaders";
         std::string destPath = outputPath + "/Shaders";
@@ -110,23 +120,32 @@ bool GameBuilder::CopyShaders(const std::string& outputPath) {
     }
 }
 
+std::string GameBuilder::GetExportedSceneName(const std::string& scene) {
+    return fs::path(scene).stem().string() + SceneSerializer::BINARY_EXTENSION;
+}
+
 bool GameBuilder::CopyScenes(const BuildSettings& settings, const std::string& outputPath) {
+    MOLGA_PROFILE("GameBuilder::CopyScenes");
+
     try {
         std::string scenesPath = outputPath + "/scenes";
         fs::create_directories(scenesPath);
 
-        // Copy main scene
+        // Scenes ship in the binary format; the JSON stays in the project
         if (fs::exists(settings.mainScene)) {
-            fs::copy_file(settings.mainScene, scenesPath + "/main.json",
-                         fs::copy_options::overwrite_existing);
+            if (!SceneSerializer::ConvertScene(settings.mainScene, scenesPath + "/main" + SceneSerializer::BINARY_EXTENSION)) {
+                lastError = "Failed to convert scene: " + settings.mainScene;
+                return false;
+            }
         }
 
-        // Copy additional scenes
+        // Convert additional scenes
         for (const auto& scene : settings.scenes) {
             if (fs::exists(scene)) {
-                std::string filename = fs::path(scene).filename().string();
-                fs::copy_file(scene, scenesPath + "/" + filename,
-                             fs::copy_options::overwrite_existing);
+                if (!SceneSerializer::ConvertScene(scene, scenesPath + "/" + GetExportedSceneName(scene))) {
+                    lastError = "Failed to convert scene: " + scene;
+                    return false;
+                }
             }
         }
 
@@ -138,20 +157,25 @@ bool GameBuilder::CopyScenes(const BuildSettings& settings, const std::string& o
 }
 
 bool GameBuilder::GenerateGameConfig(const BuildSettings& settings, const std::string& outputPath) {
+    MOLGA_PROFILE("GameBuilder::GenerateGameConfig");
+
     try {
         nlohmann::json config;
         config["gameName"] = settings.gameName;
-        config["mainScene"] = "scenes/main.json";
+        std::string mainScene = std::string("scenes/main") + SceneSerializer::BINARY_EXTENSION;
+        config["mainScene"] = mainScene;
         config["windowWidth"] = settings.windowWidth;
         config["windowHeight"] = settings.windowHeight;
         config["fullscreen"] = settings.fullscreen;
+        config["fixedUpdateRate"] = settings.fixedUpdateRate;
+        config["maxSubSteps"] = settings.maxSubSteps;
+        config["interpolate"] = settings.interpolate;
 
         // List all scenes
         nlohmann::json scenesList = nlohmann::json::array();
-        scenesList.push_back("scenes/main.json");
+        scenesList.push_back(mainScene);
         for (const auto& scene : settings.scenes) {
-            std::string filename = fs::path(scene).filename().string();
-            scenesList.push_back("scenes/" + filename);
+            scenesList.push_back("scenes/" + GetExportedSceneName(scene));
         }
         config["scenes"] = scenesList;
 
@@ -171,6 +195,8 @@ bool GameBuilder::GenerateGameConfig(const BuildSettings& settings, const std::s
 }
 
 bool GameBuilder::CopyExecutable(const std::string& outputPath, const std::string& gameName) {
+    MOLGA_PROFILE("GameBuilder::CopyExecutable");
+
     try {
         // Find the runtime executable
         std::string runtimePath = "build/molga_runtime";
@@ -12,6 +12,9 @@ struct BuildSettings {
     int windowWidth = 800;
     int windowHeight = 600;
     bool fullscreen = false;
+    int fixedUpdateRate = 60;  // Simulation steps per second
+    int maxSubSteps = 5;
+    bool interpolate = true;
     bool showConsole = false;  // For Windows
 };
 
@@ -39,6 +42,9 @@ private:
     bool CopyExecutable(const std::string& outputPath, const std::string& gameName);
     bool CopyScenes(const BuildSettings& settings, const std::string& outputPath);
 
+    // File name of a scene inside the exported scenes directory
+    static std::string GetExportedSceneName(const std::string& scene);
+
     std::string lastError;
     float progress = 0.0f;
     std::string currentStep;
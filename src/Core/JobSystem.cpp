@@ -0,0 +1,290 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <iostream>
+#include <string>
+
+namespace {
+
+// Index into JobSystem::threads of the calling thread, -1 if it owns no deque
+thread_local int t_threadIndex = -1;
+
+// Static initialization runs on the thread that enters main()
+const std::thread::id g_mainThreadId = std::this_thread::get_id();
+
+constexpr int SPINS_BEFORE_SLEEP = 64;
+
+} // namespace
+
+// ============ JobDeque ============
+
+// Chase-Lev deque with the C11 memory orderings from Le et al., "Correct
+// and Efficient Work-Stealing for Weak Memory Models" (2013)
+
+bool JobDeque::Push(Job* job) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= CAPACITY) return false;
+
+    // Release publishes the job to thieves that acquire bottom
+    buffer[b & MASK].store(job, std::memory_order_relaxed);
+    bottom.store(b + 1, std::memory_order_release);
+    return true;
+}
+
+Job* JobDeque::Pop() {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // Empty
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = buffer[b & MASK].load(std::memory_order_relaxed);
+    if (t == b) {
+        // Last job: race the thieves for it
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* JobDeque::Steal() {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+
+    Job* job = buffer[t & MASK].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;     // Lost to the owner or another thief
+    }
+    return job;
+}
+
+// ============ JobSystem ============
+
+JobSystem& JobSystem::Get() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::JobSystem() {
+    // Workers record profiler zones until they are joined in our destructor,
+    // so the profiler must be destroyed after us
+    Profiler::Get();
+}
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+bool JobSystem::IsMainThread() {
+    return std::this_thread::get_id() == g_mainThreadId;
+}
+
+void JobSystem::Init(unsigned int workerCount) {
+    if (IsRunning()) return;
+
+    if (workerCount == 0) {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 0;
+    }
+    if (workerCount == 0) {
+        std::cout << "[JobSystem] Single hardware thread, jobs run inline" << std::endl;
+        return;
+    }
+
+    threads.clear();
+    for (unsigned int i = 0; i <= workerCount; i++) {
+        threads.push_back(std::make_unique<ThreadState>());
+    }
+    t_threadIndex = 0;
+
+    stopping = false;
+    for (unsigned int i = 1; i <= workerCount; i++) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+
+    std::cout << "[JobSystem] Started " << workerCount << " worker threads" << std::endl;
+}
+
+void JobSystem::Shutdown() {
+    if (!IsRunning()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Finish what the workers left behind; dependents released by these
+    // jobs are queued on our deque and picked up too
+    while (Job* job = FindJob()) {
+        Execute(job);
+    }
+
+    workers.clear();
+    threads.clear();
+    queued = 0;
+    t_threadIndex = -1;
+}
+
+Job* JobSystem::AllocateJob() {
+    if (t_threadIndex < 0) return nullptr;
+
+    // Ring of jobs per submitting thread. A slot comes round again after
+    // JOB_POOL_SIZE submissions; if its job has not run yet (a long queue,
+    // or parked on a dependency) help run jobs until it has. Jobs run while
+    // helping may submit jobs themselves, so look at the ring again each time.
+    ThreadState& state = *threads[t_threadIndex];
+    static_assert((JOB_POOL_SIZE & (JOB_POOL_SIZE - 1)) == 0, "JOB_POOL_SIZE must be a power of two");
+    while (true) {
+        Job* job = &state.jobs[state.nextJob & (JOB_POOL_SIZE - 1)];
+        if (!job->busy.load(std::memory_order_acquire)) {
+            job->busy.store(true, std::memory_order_relaxed);
+            state.nextJob++;
+            return job;
+        }
+
+        Job* other = FindJob();
+        if (other) {
+            Execute(other);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::Submit(Job* job, JobCounter* dependency) {
+    if (dependency) {
+        std::lock_guard<std::mutex> lock(dependency->mutex);
+        if (dependency->pending.load(std::memory_order_acquire) > 0) {
+            dependency->dependents.push_back(job);
+            return;
+        }
+    }
+    Enqueue(job);
+}
+
+void JobSystem::Enqueue(Job* job) {
+    if (!threads[t_threadIndex]->deque.Push(job)) {
+        // Deque full: running it now keeps the program correct
+        Execute(job);
+        return;
+    }
+
+    queued.fetch_add(1);
+    if (sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wake.notify_one();
+    }
+}
+
+Job* JobSystem::FindJob() {
+    if (t_threadIndex < 0) return nullptr;
+
+    Job* job = threads[t_threadIndex]->deque.Pop();
+
+    // Steal, starting after our own index so thieves spread out
+    size_t count = threads.size();
+    for (size_t i = 1; !job && i < count; i++) {
+        job = threads[(t_threadIndex + i) % count]->deque.Steal();
+    }
+
+    if (job) {
+        queued.fetch_sub(1);
+    }
+    return job;
+}
+
+void JobSystem::Execute(Job* job) {
+    JobCounter* counter = job->counter;
+    job->invoke(*job);
+
+    // The callable is destroyed; its submitter may reuse the slot
+    job->busy.store(false, std::memory_order_release);
+    Finish(counter);
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+    if (!counter) return;
+
+    // Decrement under the lock: a dependent registered concurrently is
+    // either seen here or sees the zero count and queues itself
+    std::vector<Job*> ready;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ready.swap(counter->dependents);
+        }
+    }
+
+    for (Job* job : ready) {
+        Enqueue(job);
+    }
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        Job* job = FindJob();
+        if (job) {
+            Execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // The finishing thread may still hold the mutex; the counter can be
+    // destroyed once we return
+    std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+void JobSystem::WorkerLoop(unsigned int index) {
+    t_threadIndex = static_cast<int>(index);
+    Profiler::Get().SetThreadName("Job Worker " + std::to_string(index));
+
+    int spins = 0;
+    while (!stopping.load(std::memory_order_relaxed)) {
+        Job* job = FindJob();
+        if (job) {
+            Execute(job);
+            spins = 0;
+            continue;
+        }
+
+        if (++spins < SPINS_BEFORE_SLEEP) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Announce sleeping before checking for work; Enqueue bumps
+        // queued before checking for sleepers, so one side sees the other
+        sleeping.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this] { return stopping.load() || queued.load() > 0; });
+        }
+        sleeping.fetch_sub(1);
+        spins = 0;
+    }
+}
+
+#ifndef NDEBUG
+void ReportWrongThread(const char* context) {
+    static std::atomic<bool> reported{false};
+    if (!reported.exchange(true)) {
+        std::cerr << "[JobSystem] " << context << " called off the main thread; "
+                  << "GL work must stay on the main thread" << std::endl;
+    }
+}
+#endif
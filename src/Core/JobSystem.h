@@ -0,0 +1,215 @@
+#ifndef MOLGA_JOB_SYSTEM_H
+#define MOLGA_JOB_SYSTEM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobCounter;
+
+// A unit of work. The callable is stored inline, so submitting a job never
+// allocates.
+struct Job {
+    static constexpr size_t STORAGE_SIZE = 64;
+
+    void (*invoke)(Job& job) = nullptr;
+    JobCounter* counter = nullptr;          // Decremented when the job finished
+    std::atomic<bool> busy{false};          // Submitted and not yet run; the slot can't be reused
+    alignas(std::max_align_t) unsigned char storage[STORAGE_SIZE];
+};
+
+// Counts unfinished jobs. Wait() on it, or pass it as the dependency of
+// later jobs: they are queued only once the count drops to zero. A counter
+// can be reused once it is done.
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int> pending{0};
+    std::mutex mutex;
+    std::vector<Job*> dependents;           // Queued when pending reaches zero
+};
+
+// Chase-Lev work-stealing deque of fixed capacity. The owning thread
+// pushes and pops at the bottom (LIFO, cache-warm); other threads steal
+// from the top (FIFO).
+class JobDeque {
+public:
+    static constexpr int64_t CAPACITY = 4096;
+
+    // Owner only. Returns false when full.
+    bool Push(Job* job);
+    Job* Pop();
+
+    // Any thread
+    Job* Steal();
+
+private:
+    static constexpr int64_t MASK = CAPACITY - 1;
+    static_assert((CAPACITY & MASK) == 0, "JobDeque capacity must be a power of two");
+
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    std::atomic<Job*> buffer[CAPACITY];
+};
+
+// Work-stealing job system. Every worker and the main thread own a deque;
+// idle threads steal from the others, and a thread waiting on a counter
+// runs jobs instead of blocking.
+//
+// Jobs may be submitted from the main thread and from inside jobs. The
+// system is opt-in: until Init() is called (or with zero workers) Run()
+// and ParallelFor() execute inline on the calling thread, so engine code
+// can use them unconditionally.
+//
+// Jobs never touch GL. Everything that issues GL calls (Renderer,
+// SpriteBatch, Shader, Texture uploads) stays on the main thread; debug
+// builds report violations through MOLGA_ASSERT_MAIN_THREAD.
+class JobSystem {
+public:
+    // Jobs submitted per thread that may be queued, running or waiting on a
+    // dependency at once. Submitting more is safe but slow: the submitting
+    // thread runs other jobs until its oldest slot is free again.
+    static constexpr size_t JOB_POOL_SIZE = 4096;
+
+    static JobSystem& Get();
+
+    // workerCount 0: one worker per hardware thread besides the main thread.
+    // Call from the main thread.
+    void Init(unsigned int workerCount = 0);
+
+    // Jobs still queued run on the calling thread before it returns, so no
+    // counter is left waiting
+    void Shutdown();
+
+    bool IsRunning() const { return !workers.empty(); }
+    unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    // Threads that execute jobs: workers plus the main thread
+    unsigned int GetThreadCount() const { return GetWorkerCount() + 1; }
+
+    // Queue fn. counter (optional) is incremented now and decremented once
+    // fn returned. With a dependency the job is only queued after the
+    // dependency counter is done.
+    template<typename F>
+    void Run(F&& fn, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+    // Run jobs until the counter is done
+    void Wait(JobCounter& counter);
+
+    // Call fn(begin, end) on sub-ranges of [0, count) of about grain
+    // elements and return when all are done. The calling thread takes part.
+    template<typename F>
+    void ParallelFor(size_t count, size_t grain, F&& fn);
+
+    static bool IsMainThread();
+
+private:
+    JobSystem();
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    struct ThreadState {
+        JobDeque deque;
+        Job jobs[JOB_POOL_SIZE];
+        size_t nextJob = 0;
+    };
+
+    Job* AllocateJob();
+    void Submit(Job* job, JobCounter* dependency);
+    void Enqueue(Job* job);
+    Job* FindJob();
+    void Execute(Job* job);
+    void Finish(JobCounter* counter);
+    void WorkerLoop(unsigned int index);
+
+    std::vector<std::unique_ptr<ThreadState>> threads;  // [0] is the main thread
+    std::vector<std::thread> workers;
+
+    std::atomic<bool> stopping{false};
+    std::atomic<int> queued{0};             // Jobs in any deque
+    std::atomic<int> sleeping{0};           // Workers waiting on wake
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+};
+
+template<typename F>
+void JobSystem::Run(F&& fn, JobCounter* counter, JobCounter* dependency) {
+    using Callable = typename std::decay<F>::type;
+    static_assert(sizeof(Callable) <= Job::STORAGE_SIZE, "Job callable captures too much; capture a pointer");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t), "Job callable is over-aligned");
+
+    Job* job = IsRunning() ? AllocateJob() : nullptr;
+    if (!job) {
+        // Not started, or submitted from a thread without a deque
+        if (dependency) Wait(*dependency);
+        fn();
+        return;
+    }
+
+    new (job->storage) Callable(std::forward<F>(fn));
+    job->invoke = [](Job& self) {
+        Callable* callable = reinterpret_cast<Callable*>(self.storage);
+        (*callable)();
+        callable->~Callable();
+    };
+    job->counter = counter;
+    if (counter) {
+        counter->pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    Submit(job, dependency);
+}
+
+template<typename F>
+void JobSystem::ParallelFor(size_t count, size_t grain, F&& fn) {
+    if (count == 0) return;
+    grain = std::max<size_t>(grain, 1);
+
+    if (!IsRunning() || count <= grain) {
+        fn(size_t(0), count);
+        return;
+    }
+
+    // A few chunks per thread balance uneven work without flooding the
+    // deques with tiny jobs
+    size_t maxChunks = static_cast<size_t>(GetThreadCount()) * 4;
+    size_t chunk = std::max(grain, (count + maxChunks - 1) / maxChunks);
+
+    JobCounter counter;
+    auto* body = &fn;
+    for (size_t begin = chunk; begin < count; begin += chunk) {
+        size_t end = std::min(begin + chunk, count);
+        Run([body, begin, end] { (*body)(begin, end); }, &counter);
+    }
+
+    // The first chunk runs here while the others are picked up
+    fn(size_t(0), std::min(chunk, count));
+    Wait(counter);
+}
+
+#ifndef NDEBUG
+void ReportWrongThread(const char* context);
+#define MOLGA_ASSERT_MAIN_THREAD(context) \
+    do { if (!JobSystem::IsMainThread()) ReportWrongThread(context); } while (0)
+#else
+#define MOLGA_ASSERT_MAIN_THREAD(context) ((void)0)
+#endif
+
+#endif // MOLGA_JOB_SYSTEM_H
@@ -0,0 +1,283 @@
+#include "Profiler.h"
+#include "TraceWriter.h"
+#ifndef MOLGA_HEADLESS
+#include <glad/glad.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+std::atomic<bool> Profiler::enabled{false};
+
+namespace {
+
+const std::chrono::steady_clock::time_point g_profilerEpoch = std::chrono::steady_clock::now();
+
+} // namespace
+
+Profiler& Profiler::Get() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler() = default;
+
+Profiler::~Profiler() = default;
+
+uint64_t Profiler::Now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - g_profilerEpoch).count());
+}
+
+uint32_t& Profiler::ThreadDepth() {
+    thread_local uint32_t depth = 0;
+    return depth;
+}
+
+void Profiler::SetEnabled(bool value) {
+    enabled.store(value, std::memory_order_relaxed);
+    std::cout << "[Profiler] " << (value ? "Enabled" : "Disabled") << std::endl;
+}
+
+Profiler::ThreadRing* Profiler::GetThreadRing() {
+    thread_local ThreadRing* ring = nullptr;
+    if (!ring) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(std::make_unique<ThreadRing>());
+        ring = rings.back().get();
+        ring->threadIndex = static_cast<uint32_t>(rings.size() - 1);
+        ring->name = ring->threadIndex == 0 ? "Main" : "Thread " + std::to_string(ring->threadIndex);
+    }
+    return ring;
+}
+
+void Profiler::RecordZone(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth) {
+    ThreadRing* ring = GetThreadRing();
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    if (head - tail >= RING_CAPACITY) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ProfileZone& zone = ring->zones[head & (RING_CAPACITY - 1)];
+    zone.name = name;
+    zone.startNs = startNs;
+    zone.endNs = endNs;
+    zone.depth = depth;
+    zone.threadIndex = ring->threadIndex;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::SetThreadName(const std::string& name) {
+    ThreadRing* ring = GetThreadRing();
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    ring->name = name;
+}
+
+std::string Profiler::GetThreadName(uint32_t threadIndex) const {
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    if (threadIndex < rings.size()) {
+        return rings[threadIndex]->name;
+    }
+    return std::string();
+}
+
+uint32_t Profiler::GetThreadCount() const {
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    return static_cast<uint32_t>(rings.size());
+}
+
+uint64_t Profiler::GetDroppedZones() const {
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    uint64_t dropped = 0;
+    for (const auto& ring : rings) {
+        dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void Profiler::BeginFrame() {
+    // Register the main thread first so it gets index 0
+    GetThreadRing();
+
+    if (!IsEnabled()) {
+        frameOpen = false;
+        return;
+    }
+
+    current = ProfileFrame();
+    current.index = frameIndex++;
+    current.startNs = Now();
+    frameOpen = true;
+}
+
+void Profiler::EndFrame() {
+    if (!frameOpen) {
+        ResolveGpuQueries();
+        return;
+    }
+    frameOpen = false;
+    current.endNs = Now();
+
+    // Drain every thread's ring; zones from other threads land in the frame
+    // during which they completed
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (auto& ring : rings) {
+            uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+            uint64_t head = ring->head.load(std::memory_order_acquire);
+            for (uint64_t i = tail; i < head; i++) {
+                current.zones.push_back(ring->zones[i & (RING_CAPACITY - 1)]);
+            }
+            ring->tail.store(head, std::memory_order_release);
+        }
+    }
+
+    if (TraceWriter::Get().IsRecording()) {
+        TraceWriter::Get().SubmitFrame(current);
+    }
+
+    history.push_back(std::move(current));
+    if (history.size() > HISTORY_SIZE) {
+        history.pop_front();
+    }
+
+    ResolveGpuQueries();
+}
+
+void Profiler::PrintSummary(size_t frameCount) const {
+    size_t count = std::min(frameCount, history.size());
+    if (count == 0) return;
+
+    struct Total {
+        std::string name;
+        double milliseconds = 0.0;
+        bool gpu = false;
+    };
+    std::unordered_map<std::string, Total> totals;
+    double frameMs = 0.0;
+    double worstMs = 0.0;
+
+    for (size_t i = history.size() - count; i < history.size(); i++) {
+        const ProfileFrame& frame = history[i];
+        frameMs += frame.GetMilliseconds();
+        worstMs = std::max(worstMs, frame.GetMilliseconds());
+
+        for (const auto& zone : frame.zones) {
+            Total& total = totals[zone.name];
+            total.name = zone.name;
+            total.milliseconds += (zone.endNs - zone.startNs) / 1000000.0;
+        }
+        for (const auto& zone : frame.gpuZones) {
+            Total& total = totals[std::string("GPU ") + zone.name];
+            total.name = std::string("GPU ") + zone.name;
+            total.milliseconds += zone.milliseconds;
+            total.gpu = true;
+        }
+    }
+
+    std::vector<Total> sorted;
+    for (auto& entry : totals) {
+        sorted.push_back(entry.second);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Total& a, const Total& b) {
+        return a.milliseconds > b.milliseconds;
+    });
+
+    std::printf("[Profiler] %zu frames: avg %.3f ms, worst %.3f ms\n", count, frameMs / count, worstMs);
+    for (size_t i = 0; i < sorted.size() && i < 10; i++) {
+        std::printf("[Profiler]   %-36s %8.3f ms/frame\n", sorted[i].name.c_str(), sorted[i].milliseconds / count);
+    }
+    std::fflush(stdout);
+}
+
+// ============ GPU timing ============
+
+#ifndef MOLGA_HEADLESS
+
+void Profiler::InitGpu() {
+    gpuAvailable = true;
+}
+
+void Profiler::ShutdownGpu() {
+    if (!gpuAvailable) return;
+
+    for (const auto& pending : pendingQueries) {
+        freeQueries.push_back(pending.query);
+    }
+    pendingQueries.clear();
+
+    if (!freeQueries.empty()) {
+        glDeleteQueries(static_cast<GLsizei>(freeQueries.size()), freeQueries.data());
+        freeQueries.clear();
+    }
+    gpuAvailable = false;
+    gpuZoneOpen = false;
+}
+
+bool Profiler::BeginGpuZone(const char* name) {
+    // GL_TIME_ELAPSED queries can't nest
+    if (!gpuAvailable || !frameOpen || gpuZoneOpen) return false;
+
+    unsigned int query = 0;
+    if (!freeQueries.empty()) {
+        query = freeQueries.back();
+        freeQueries.pop_back();
+    } else {
+        glGenQueries(1, &query);
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    pendingQueries.push_back({ current.index, name, query });
+    gpuZoneOpen = true;
+    return true;
+}
+
+void Profiler::EndGpuZone() {
+    if (!gpuZoneOpen) return;
+
+    glEndQuery(GL_TIME_ELAPSED);
+    gpuZoneOpen = false;
+}
+
+void Profiler::ResolveGpuQueries() {
+    // Results arrive in submission order; stop at the first one not ready
+    // rather than stalling the pipeline
+    while (!pendingQueries.empty()) {
+        const PendingGpuQuery& pending = pendingQueries.front();
+        if (gpuZoneOpen && &pending == &pendingQueries.back()) break;
+
+        GLint available = 0;
+        glGetQueryObjectiv(pending.query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(pending.query, GL_QUERY_RESULT, &elapsedNs);
+
+        if (!history.empty() && pending.frameIndex >= history.front().index) {
+            size_t offset = static_cast<size_t>(pending.frameIndex - history.front().index);
+            if (offset < history.size()) {
+                history[offset].gpuZones.push_back({ pending.name, elapsedNs / 1000000.0 });
+            }
+        }
+
+        freeQueries.push_back(pending.query);
+        pendingQueries.pop_front();
+    }
+}
+
+#else
+
+// GL-free builds have no GPU zones
+void Profiler::InitGpu() {}
+void Profiler::ShutdownGpu() {}
+bool Profiler::BeginGpuZone(const char*) { return false; }
+void Profiler::EndGpuZone() {}
+void Profiler::ResolveGpuQueries() {}
+
+#endif // MOLGA_HEADLESS
@@ -0,0 +1,190 @@
+#ifndef MOLGA_PROFILER_H
+#define MOLGA_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Completed CPU zone. Names must be string literals (or otherwise outlive
+// the profiler); only the pointer is stored.
+struct ProfileZone {
+    const char* name;
+    uint64_t startNs;           // Since Profiler start
+    uint64_t endNs;
+    uint32_t depth;             // Nesting level on its thread
+    uint32_t threadIndex;
+};
+
+struct GpuZone {
+    const char* name;
+    double milliseconds;
+};
+
+struct ProfileFrame {
+    uint64_t index = 0;
+    uint64_t startNs = 0;
+    uint64_t endNs = 0;
+    std::vector<ProfileZone> zones;
+    std::vector<GpuZone> gpuZones;  // Filled in a few frames later
+
+    double GetMilliseconds() const { return (endNs - startNs) / 1000000.0; }
+};
+
+// Frame profiler. Zones are recorded with MOLGA_PROFILE("name") into a
+// lock-free ring buffer owned by the recording thread; EndFrame() (main
+// thread) drains every ring into the frame history. GPU zones time render
+// passes with GL_TIME_ELAPSED queries and cannot nest: a GPU zone opened
+// inside another one is ignored and counted in the outer zone.
+//
+// Recording is off by default. When disabled, a zone costs one relaxed
+// atomic load. Build with MOLGA_ENABLE_PROFILER=OFF to compile zones out.
+class Profiler {
+public:
+    static constexpr size_t HISTORY_SIZE = 300;
+    static constexpr size_t RING_CAPACITY = 1 << 14;
+
+    static Profiler& Get();
+
+    static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool value);
+
+    // Frame boundaries (main thread)
+    void BeginFrame();
+    void EndFrame();
+
+    // Must be called with a current GL context before GPU zones are recorded
+    void InitGpu();
+    void ShutdownGpu();
+
+    // Called by ProfileScope
+    void RecordZone(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth);
+    static uint64_t Now();
+    static uint32_t& ThreadDepth();
+
+    // GPU zones (GL thread). BeginGpuZone returns false if the zone was not
+    // opened; only call EndGpuZone when it returned true.
+    bool BeginGpuZone(const char* name);
+    void EndGpuZone();
+
+    // Name shown for the calling thread
+    void SetThreadName(const std::string& name);
+    std::string GetThreadName(uint32_t threadIndex) const;
+    uint32_t GetThreadCount() const;
+
+    // History, oldest first
+    const std::deque<ProfileFrame>& GetHistory() const { return history; }
+
+    // Zones lost because a ring was full
+    uint64_t GetDroppedZones() const;
+
+    // Print average frame time and the most expensive zones over the last
+    // frameCount frames to stdout (for runs without the editor)
+    void PrintSummary(size_t frameCount) const;
+
+private:
+    Profiler();
+    ~Profiler();
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // Single-producer (owning thread) / single-consumer (EndFrame) ring
+    struct ThreadRing {
+        ProfileZone zones[RING_CAPACITY];
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+        uint32_t threadIndex = 0;
+        std::string name;
+    };
+
+    struct PendingGpuQuery {
+        uint64_t frameIndex;
+        const char* name;
+        unsigned int query;
+    };
+
+    ThreadRing* GetThreadRing();
+    void ResolveGpuQueries();
+
+    static std::atomic<bool> enabled;
+
+    mutable std::mutex ringsMutex;
+    std::vector<std::unique_ptr<ThreadRing>> rings;
+
+    std::deque<ProfileFrame> history;
+    ProfileFrame current;
+    uint64_t frameIndex = 0;
+    bool frameOpen = false;
+
+    bool gpuAvailable = false;
+    bool gpuZoneOpen = false;
+    std::vector<unsigned int> freeQueries;
+    std::deque<PendingGpuQuery> pendingQueries;
+};
+
+// Records a CPU zone from construction to destruction
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : name(name) {
+        if (Profiler::IsEnabled()) {
+            depth = Profiler::ThreadDepth()++;
+            startNs = Profiler::Now();
+            active = true;
+        }
+    }
+
+    ~ProfileScope() {
+        if (active) {
+            Profiler::ThreadDepth()--;
+            Profiler::Get().RecordZone(name, startNs, Profiler::Now(), depth);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name;
+    uint64_t startNs = 0;
+    uint32_t depth = 0;
+    bool active = false;
+};
+
+// Times the GL commands issued in its scope
+class GpuProfileScope {
+public:
+    explicit GpuProfileScope(const char* name) {
+        if (Profiler::IsEnabled()) {
+            active = Profiler::Get().BeginGpuZone(name);
+        }
+    }
+
+    ~GpuProfileScope() {
+        if (active) {
+            Profiler::Get().EndGpuZone();
+        }
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    bool active = false;
+};
+
+#define MOLGA_PROFILE_CONCAT_INNER(a, b) a##b
+#define MOLGA_PROFILE_CONCAT(a, b) MOLGA_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef MOLGA_PROFILING
+    #define MOLGA_PROFILE(name) ProfileScope MOLGA_PROFILE_CONCAT(molgaProfileScope, __LINE__)(name)
+    #define MOLGA_PROFILE_GPU(name) GpuProfileScope MOLGA_PROFILE_CONCAT(molgaGpuProfileScope, __LINE__)(name)
+#else
+    #define MOLGA_PROFILE(name) ((void)0)
+    #define MOLGA_PROFILE_GPU(name) ((void)0)
+#endif
+
+#endif // MOLGA_PROFILER_H
@@ -141,6 +141,7 @@ bool Project::CreateDirectoryStructure() {
         fs::create_directories(basePath / "Assets" / "Textures");
         fs::create_directories(basePath / "Assets" / "Audio");
         fs::create_directories(basePath / "Assets" / "Scripts");
+        fs::create_directories(basePath / "Assets" / "Fonts");
         fs::create_directories(basePath / "Scenes");
         fs::create_directories(basePath / "ProjectSettings");
 
@@ -4,11 +4,19 @@
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/SpriteRenderer.h"
 #include "../ECS/Components/BoxCollider2D.h"
+#include "BinaryStream.h"
+#include "../Platform/MappedFile.h"
+#include "Profiler.h"
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <iostream>
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <string_view>
+#include <cstdint>
+#include <cstring>
 
 using json = nlohmann::json;
 
@@ -24,8 +32,524 @@ static std::unordered_map<std::string, ComponentFactory>& GetComponentFactories(
     return factories;
 }
 
+// ============ Binary (.mscene) layout ============
+// All offsets are in bytes from the start of the file; tables are 8-byte
+// aligned so they can be read in place from the mapping.
+
+namespace {
+
+struct SceneFileHeader {
+    char magic[4];              // "MSCN"
+    uint32_t version;
+    uint32_t typeCount;
+    uint32_t objectCount;
+    uint32_t componentCount;
+    uint32_t reserved;
+    uint64_t typeTableOffset;
+    uint64_t objectTableOffset;
+    uint64_t componentTableOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+};
+
+struct StringRef {
+    uint32_t offset;            // Into the string region
+    uint32_t length;
+};
+
+struct ObjectRecord {
+    StringRef name;
+    uint64_t id;
+    uint32_t firstComponent;    // Index into the component table
+    uint32_t componentCount;
+    uint8_t active;
+    uint8_t padding[7];
+};
+
+struct ComponentRecord {
+    uint32_t typeIndex;         // Index into the type table
+    uint32_t dataSize;
+    uint64_t dataOffset;        // Into the data region
+};
+
+const char SCENE_MAGIC[4] = { 'M', 'S', 'C', 'N' };
+
+template<typename T>
+const T* TableAt(const uint8_t* base, size_t fileSize, uint64_t offset, uint64_t count) {
+    if (offset % alignof(T) != 0 || offset > fileSize) return nullptr;
+    if (count > (fileSize - offset) / sizeof(T)) return nullptr;
+    return reinterpret_cast<const T*>(base + offset);
+}
+
+// ============ Record hashes (SceneFingerprint) ============
+
+// FNV-1a
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t HashString(std::string_view str, uint64_t hash) {
+    uint64_t length = str.size();
+    hash = HashBytes(&length, sizeof(length), hash);
+    return HashBytes(str.data(), str.size(), hash);
+}
+
+// Binary records: name, active flag, then each component's type and data
+uint64_t HashBinaryObject(std::string_view name, uint8_t active) {
+    uint64_t hash = HashString(name, 14695981039346656037ull);
+    return HashBytes(&active, sizeof(active), hash);
+}
+
+uint64_t HashBinaryComponent(uint64_t hash, std::string_view type, const uint8_t* data, size_t size) {
+    hash = HashString(type, hash);
+    return HashString(std::string_view(reinterpret_cast<const char*>(data), size), hash);
+}
+
+// JSON records: the object's JSON minus the id, which changes every session
+uint64_t HashJsonObject(const json& objJson) {
+    std::string text;
+    if (objJson.contains("id")) {
+        json copy = objJson;
+        copy.erase("id");
+        text = copy.dump();
+    } else {
+        text = objJson.dump();
+    }
+    return HashString(text, 14695981039346656037ull);
+}
+
+std::shared_ptr<GameObject> ObjectFromJson(const json& objJson) {
+    std::string name = objJson.value("name", "GameObject");
+    auto obj = std::make_shared<GameObject>(name);
+    obj->SetActive(objJson.value("active", true));
+
+    auto& factories = GetComponentFactories();
+
+    if (objJson.contains("components")) {
+        for (const auto& compJson : objJson["components"]) {
+            std::string type = compJson.value("type", "");
+
+            auto factoryIt = factories.find(type);
+            if (factoryIt != factories.end()) {
+                Component* comp = factoryIt->second(obj.get());
+                if (comp) {
+                    comp->Deserialize(compJson);
+                }
+            } else {
+                std::cerr << "[SceneSerializer] Unknown component type: " << type << std::endl;
+            }
+        }
+    }
+    return obj;
+}
+
+// A mapped .mscene file whose header and tables have been checked
+class BinaryScene {
+public:
+    bool Open(const std::string& filepath);
+
+    uint32_t GetObjectCount() const { return header.objectCount; }
+    uint64_t HashObject(uint32_t index) const;
+    std::shared_ptr<GameObject> CreateObject(uint32_t index) const;
+
+private:
+    std::string_view GetString(const StringRef& ref) const {
+        if (ref.offset > header.stringsSize || ref.length > header.stringsSize - ref.offset) {
+            return std::string_view();
+        }
+        return std::string_view(strings + ref.offset, ref.length);
+    }
+
+    // The object's components that are in range, with a known type
+    template<typename Fn>
+    void ForEachComponent(const ObjectRecord& record, Fn&& fn) const;
+
+    Platform::MappedFile file;
+    SceneFileHeader header = {};
+    const StringRef* types = nullptr;
+    const ObjectRecord* objectTable = nullptr;
+    const ComponentRecord* componentTable = nullptr;
+    const char* strings = nullptr;
+    const uint8_t* data = nullptr;
+
+    // Resolved once per type instead of once per component
+    std::vector<const ComponentFactory*> typeFactories;
+};
+
+bool BinaryScene::Open(const std::string& filepath) {
+    if (!file.Open(filepath)) {
+        std::cerr << "[SceneSerializer] Failed to open file: " << filepath << std::endl;
+        return false;
+    }
+
+    const uint8_t* base = static_cast<const uint8_t*>(file.GetData());
+    size_t fileSize = file.GetSize();
+
+    if (fileSize < sizeof(SceneFileHeader)) {
+        std::cerr << "[SceneSerializer] File too small for a scene header: " << filepath << std::endl;
+        return false;
+    }
+
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, SCENE_MAGIC, sizeof(header.magic)) != 0) {
+        std::cerr << "[SceneSerializer] Not a binary scene file: " << filepath << std::endl;
+        return false;
+    }
+    if (header.version != SceneSerializer::BINARY_VERSION) {
+        std::cerr << "[SceneSerializer] Unsupported scene version " << header.version
+                  << " (expected " << SceneSerializer::BINARY_VERSION << "): " << filepath << std::endl;
+        return false;
+    }
+
+    types = TableAt<StringRef>(base, fileSize, header.typeTableOffset, header.typeCount);
+    objectTable = TableAt<ObjectRecord>(base, fileSize, header.objectTableOffset, header.objectCount);
+    componentTable = TableAt<ComponentRecord>(base, fileSize, header.componentTableOffset, header.componentCount);
+    strings = TableAt<char>(base, fileSize, header.stringsOffset, header.stringsSize);
+    data = TableAt<uint8_t>(base, fileSize, header.dataOffset, header.dataSize);
+    if (!types || !objectTable || !componentTable || !strings || !data) {
+        std::cerr << "[SceneSerializer] Corrupt scene tables: " << filepath << std::endl;
+        return false;
+    }
+
+    auto& factories = GetComponentFactories();
+    typeFactories.assign(header.typeCount, nullptr);
+    for (uint32_t i = 0; i < header.typeCount; i++) {
+        std::string typeName(GetString(types[i]));
+        auto factoryIt = factories.find(typeName);
+        if (factoryIt != factories.end()) {
+            typeFactories[i] = &factoryIt->second;
+        } else {
+            std::cerr << "[SceneSerializer] Unknown component type: " << typeName << std::endl;
+        }
+    }
+    return true;
+}
+
+template<typename Fn>
+void BinaryScene::ForEachComponent(const ObjectRecord& record, Fn&& fn) const {
+    if (record.firstComponent > header.componentCount ||
+        record.componentCount > header.componentCount - record.firstComponent) return;
+
+    for (uint32_t c = 0; c < record.componentCount; c++) {
+        const ComponentRecord& compRecord = componentTable[record.firstComponent + c];
+        if (compRecord.typeIndex >= header.typeCount || !typeFactories[compRecord.typeIndex]) continue;
+        if (compRecord.dataOffset > header.dataSize ||
+            compRecord.dataSize > header.dataSize - compRecord.dataOffset) continue;
+
+        fn(compRecord);
+    }
+}
+
+uint64_t BinaryScene::HashObject(uint32_t index) const {
+    const ObjectRecord& record = objectTable[index];
+    uint64_t hash = HashBinaryObject(GetString(record.name), record.active);
+    ForEachComponent(record, [&](const ComponentRecord& compRecord) {
+        hash = HashBinaryComponent(hash, GetString(types[compRecord.typeIndex]),
+                                   data + compRecord.dataOffset, compRecord.dataSize);
+    });
+    return hash;
+}
+
+std::shared_ptr<GameObject> BinaryScene::CreateObject(uint32_t index) const {
+    const ObjectRecord& record = objectTable[index];
+
+    auto obj = std::make_shared<GameObject>(std::string(GetString(record.name)));
+    obj->SetActive(record.active != 0);
+
+    ForEachComponent(record, [&](const ComponentRecord& compRecord) {
+        Component* comp = (*typeFactories[compRecord.typeIndex])(obj.get());
+        if (comp) {
+            BinaryReader reader(data + compRecord.dataOffset, compRecord.dataSize);
+            comp->DeserializeBinary(reader);
+        }
+    });
+    return obj;
+}
+
+// Shared by both formats: reuse the objects of unchanged records, rebuild
+// the rest. hashRecord(i) and createObject(i) read record i of the new file.
+template<typename HashFn, typename CreateFn>
+void PatchObjects(size_t count, HashFn&& hashRecord, CreateFn&& createObject,
+                  std::vector<std::shared_ptr<GameObject>>& objects,
+                  SceneFingerprint& fingerprint, ScenePatch& patch) {
+    std::vector<uint64_t> hashes(count);
+    SceneFingerprint next(count);
+    std::vector<bool> oldUsed(fingerprint.size(), false);
+
+    // Unchanged records, wherever they moved (the same position first)
+    std::vector<size_t> oldIndex(count, SIZE_MAX);
+    bool moved = false;
+    for (size_t i = 0; i < count; i++) {
+        hashes[i] = hashRecord(i);
+        if (i < fingerprint.size() && fingerprint[i].hash == hashes[i]) {
+            oldUsed[i] = true;
+            oldIndex[i] = i;
+        } else {
+            moved = true;
+        }
+    }
+    if (moved) {
+        // Each old record can be matched once
+        std::unordered_multimap<uint64_t, size_t> oldByHash;
+        for (size_t i = 0; i < fingerprint.size(); i++) {
+            if (!oldUsed[i]) oldByHash.emplace(fingerprint[i].hash, i);
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (oldIndex[i] != SIZE_MAX) continue;
+            auto it = oldByHash.find(hashes[i]);
+            if (it == oldByHash.end()) continue;
+            oldUsed[it->second] = true;
+            oldIndex[i] = it->second;
+            oldByHash.erase(it);
+        }
+    }
+
+    // Where an old object sits in objects. Usually at its record index (as
+    // loaded); the map is only built if that guess fails.
+    std::unordered_map<GameObject*, size_t> slots;
+    auto findSlot = [&objects, &slots](GameObject* obj, size_t guess) -> size_t {
+        if (guess < objects.size() && objects[guess].get() == obj) return guess;
+        if (slots.empty()) {
+            slots.reserve(objects.size());
+            for (size_t i = 0; i < objects.size(); i++) {
+                if (objects[i]) slots[objects[i].get()] = i;
+            }
+        }
+        auto it = slots.find(obj);
+        return it != slots.end() ? it->second : SIZE_MAX;
+    };
+
+    // A changed record takes over the old record that followed the same
+    // unchanged neighbour: that is the one that was edited
+    size_t previousOld = SIZE_MAX;
+    for (size_t i = 0; i < count; i++) {
+        if (oldIndex[i] != SIZE_MAX) {
+            next[i] = fingerprint[oldIndex[i]];
+            previousOld = oldIndex[i];
+            patch.unchanged++;
+            continue;
+        }
+
+        std::shared_ptr<GameObject> obj = createObject(i);
+        next[i].hash = hashes[i];
+        next[i].object = obj;
+        patch.created.push_back(obj.get());
+
+        size_t slot = SIZE_MAX;
+        size_t candidate = previousOld + 1;     // 0 at the start
+        if (candidate < fingerprint.size() && !oldUsed[candidate]) {
+            oldUsed[candidate] = true;
+            previousOld = candidate;
+            if (auto old = fingerprint[candidate].object.lock()) {
+                slot = findSlot(old.get(), candidate);
+            }
+        }
+
+        if (slot != SIZE_MAX) {
+            objects[slot] = obj;
+            patch.replaced++;
+        } else {
+            objects.push_back(obj);
+            patch.added++;
+        }
+    }
+
+    // Records that are gone
+    std::unordered_set<GameObject*> removed;
+    for (size_t i = 0; i < fingerprint.size(); i++) {
+        if (oldUsed[i]) continue;
+        if (auto old = fingerprint[i].object.lock()) {
+            removed.insert(old.get());
+        }
+    }
+    if (!removed.empty()) {
+        size_t before = objects.size();
+        objects.erase(std::remove_if(objects.begin(), objects.end(),
+            [&removed](const std::shared_ptr<GameObject>& obj) {
+                return obj && removed.count(obj.get()) > 0;
+            }), objects.end());
+        patch.removed = static_cast<int>(before - objects.size());
+    }
+
+    fingerprint = std::move(next);
+}
+
+} // namespace
+
+bool SceneSerializer::IsBinaryScene(const std::string& filepath) {
+    size_t extLength = std::strlen(BINARY_EXTENSION);
+    return filepath.size() >= extLength &&
+           filepath.compare(filepath.size() - extLength, extLength, BINARY_EXTENSION) == 0;
+}
+
+bool SceneSerializer::SaveSceneBinary(const std::string& filepath,
+                                      const std::vector<std::shared_ptr<GameObject>>& objects,
+                                      SceneFingerprint* fingerprint) {
+    std::vector<StringRef> types;
+    std::unordered_map<std::string, uint32_t> typeIndices;
+    std::vector<ObjectRecord> objectRecords;
+    std::vector<ComponentRecord> componentRecords;
+    std::string strings;
+    BinaryWriter data;
+
+    auto addString = [&strings](const std::string& str) {
+        StringRef ref;
+        ref.offset = static_cast<uint32_t>(strings.size());
+        ref.length = static_cast<uint32_t>(str.size());
+        strings += str;
+        return ref;
+    };
+
+    SceneFingerprint records;
+
+    objectRecords.reserve(objects.size());
+    for (const auto& obj : objects) {
+        if (!obj) continue;
+
+        ObjectRecord record = {};
+        record.name = addString(obj->GetName());
+        record.id = obj->GetID();
+        record.active = obj->IsActive() ? 1 : 0;
+        record.firstComponent = static_cast<uint32_t>(componentRecords.size());
+
+        uint64_t hash = fingerprint ? HashBinaryObject(obj->GetName(), record.active) : 0;
+
+        for (Component* comp : obj->GetComponents()) {
+            if (!comp) continue;
+
+            std::string typeName = comp->GetTypeName();
+            auto typeIt = typeIndices.find(typeName);
+            if (typeIt == typeIndices.end()) {
+                typeIt = typeIndices.emplace(typeName, static_cast<uint32_t>(types.size())).first;
+                types.push_back(addString(typeName));
+            }
+
+            ComponentRecord compRecord = {};
+            compRecord.typeIndex = typeIt->second;
+            compRecord.dataOffset = data.GetSize();
+            comp->SerializeBinary(data);
+            compRecord.dataSize = static_cast<uint32_t>(data.GetSize() - compRecord.dataOffset);
+            if (fingerprint) {
+                hash = HashBinaryComponent(hash, typeName, data.GetBuffer().data() + compRecord.dataOffset,
+                                           compRecord.dataSize);
+            }
+            data.Align(4);
+
+            componentRecords.push_back(compRecord);
+            record.componentCount++;
+        }
+
+        objectRecords.push_back(record);
+        if (fingerprint) {
+            records.push_back({ hash, obj });
+        }
+    }
+
+    SceneFileHeader header = {};
+    std::memcpy(header.magic, SCENE_MAGIC, sizeof(header.magic));
+    header.version = BINARY_VERSION;
+    header.typeCount = static_cast<uint32_t>(types.size());
+    header.objectCount = static_cast<uint32_t>(objectRecords.size());
+    header.componentCount = static_cast<uint32_t>(componentRecords.size());
+
+    BinaryWriter file;
+    file.Write(header);
+
+    file.Align(8);
+    header.typeTableOffset = file.GetSize();
+    file.WriteBytes(types.data(), types.size() * sizeof(StringRef));
+
+    file.Align(8);
+    header.objectTableOffset = file.GetSize();
+    file.WriteBytes(objectRecords.data(), objectRecords.size() * sizeof(ObjectRecord));
+
+    file.Align(8);
+    header.componentTableOffset = file.GetSize();
+    file.WriteBytes(componentRecords.data(), componentRecords.size() * sizeof(ComponentRecord));
+
+    header.stringsOffset = file.GetSize();
+    header.stringsSize = strings.size();
+    file.WriteBytes(strings.data(), strings.size());
+
+    file.Align(8);
+    header.dataOffset = file.GetSize();
+    header.dataSize = data.GetSize();
+    file.WriteBytes(data.GetBuffer().data(), data.GetSize());
+
+    // Patch the header now that the offsets are known
+    std::memcpy(file.GetBuffer().data(), &header, sizeof(header));
+
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "[SceneSerializer] Failed to open file for writing: " << filepath << std::endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(file.GetBuffer().data()),
+              static_cast<std::streamsize>(file.GetSize()));
+    out.close();
+
+    if (fingerprint) {
+        *fingerprint = std::move(records);
+    }
+
+    std::cout << "[SceneSerializer] Scene saved to: " << filepath << std::endl;
+    return true;
+}
+
+bool SceneSerializer::LoadSceneBinary(const std::string& filepath,
+                                      std::vector<std::shared_ptr<GameObject>>& objects,
+                                      SceneFingerprint* fingerprint) {
+    MOLGA_PROFILE("SceneSerializer::LoadSceneBinary");
+
+    BinaryScene scene;
+    if (!scene.Open(filepath)) {
+        return false;
+    }
+
+    objects.clear();
+    objects.reserve(scene.GetObjectCount());
+    if (fingerprint) {
+        fingerprint->clear();
+        fingerprint->reserve(scene.GetObjectCount());
+    }
+
+    for (uint32_t i = 0; i < scene.GetObjectCount(); i++) {
+        auto obj = scene.CreateObject(i);
+        if (fingerprint) {
+            fingerprint->push_back({ scene.HashObject(i), obj });
+        }
+        objects.push_back(obj);
+    }
+
+    std::cout << "[SceneSerializer] Scene loaded from: " << filepath
+              << " (" << objects.size() << " objects)" << std::endl;
+    return true;
+}
+
+bool SceneSerializer::ConvertScene(const std::string& inputPath, const std::string& outputPath) {
+    std::vector<std::shared_ptr<GameObject>> objects;
+    if (!LoadScene(inputPath, objects)) {
+        return false;
+    }
+    return SaveScene(outputPath, objects);
+}
+
 bool SceneSerializer::SaveScene(const std::string& filepath,
-                                 const std::vector<std::shared_ptr<GameObject>>& objects) {
+                                 const std::vector<std::shared_ptr<GameObject>>& objects,
+                                 SceneFingerprint* fingerprint) {
+    if (IsBinaryScene(filepath)) {
+        return SaveSceneBinary(filepath, objects, fingerprint);
+    }
+
+    SceneFingerprint records;
+
     json sceneJson;
     sceneJson["version"] = "1.0";
     sceneJson["name"] = "Untitled Scene";
@@ -53,6 +577,9 @@ bool SceneSerializer::SaveScene(const std::string& filepath,
         }
 
         objJson["components"] = componentsArray;
+        if (fingerprint) {
+            records.push_back({ HashJsonObject(objJson), obj });
+        }
         objectsArray.push_back(objJson);
     }
 
@@ -68,62 +595,62 @@ bool SceneSerializer::SaveScene(const std::string& filepath,
     file << sceneJson.dump(2);  // Pretty print with 2-space indent
     file.close();
 
+    if (fingerprint) {
+        *fingerprint = std::move(records);
+    }
+
     std::cout << "[SceneSerializer] Scene saved to: " << filepath << std::endl;
     return true;
 }
 
-bool SceneSerializer::LoadScene(const std::string& filepath,
-                                 std::vector<std::shared_ptr<GameObject>>& objects) {
+// Parse a JSON scene file; false (logged) if it has no object list
+static bool ReadSceneJson(const std::string& filepath, json& sceneJson) {
     std::ifstream file(filepath);
     if (!file.is_open()) {
         std::cerr << "[SceneSerializer] Failed to open file: " << filepath << std::endl;
         return false;
     }
 
-    json sceneJson;
     try {
         file >> sceneJson;
     } catch (const json::parse_error& e) {
         std::cerr << "[SceneSerializer] JSON parse error: " << e.what() << std::endl;
         return false;
     }
-    file.close();
-
-    // Clear existing objects
-    objects.clear();
 
-    // Load GameObjects
-    if (!sceneJson.contains("gameObjects")) {
+    if (!sceneJson.contains("gameObjects") || !sceneJson["gameObjects"].is_array()) {
         std::cerr << "[SceneSerializer] No gameObjects in scene file" << std::endl;
         return false;
     }
+    return true;
+}
 
-    auto& factories = GetComponentFactories();
+bool SceneSerializer::LoadScene(const std::string& filepath,
+                                 std::vector<std::shared_ptr<GameObject>>& objects,
+                                 SceneFingerprint* fingerprint) {
+    MOLGA_PROFILE("SceneSerializer::LoadScene");
+
+    if (IsBinaryScene(filepath)) {
+        return LoadSceneBinary(filepath, objects, fingerprint);
+    }
+
+    json sceneJson;
+    if (!ReadSceneJson(filepath, sceneJson)) {
+        return false;
+    }
 
+    // Clear existing objects
+    objects.clear();
+    if (fingerprint) {
+        fingerprint->clear();
+    }
+
+    // Load GameObjects
     for (const auto& objJson : sceneJson["gameObjects"]) {
-        std::string name = objJson.value("name", "GameObject");
-        bool active = objJson.value("active", true);
-
-        auto obj = std::make_shared<GameObject>(name);
-        obj->SetActive(active);
-
-        // Load components using factory and deserialize
-        if (objJson.contains("components")) {
-            for (const auto& compJson : objJson["components"]) {
-                std::string type = compJson.value("type", "");
-
-                auto factoryIt = factories.find(type);
-                if (factoryIt != factories.end()) {
-                    Component* comp = factoryIt->second(obj.get());
-                    if (comp) {
-                        comp->Deserialize(compJson);
-                    }
-                } else {
-                    std::cerr << "[SceneSerializer] Unknown component type: " << type << std::endl;
-                }
-            }
+        auto obj = ObjectFromJson(objJson);
+        if (fingerprint) {
+            fingerprint->push_back({ HashJsonObject(objJson), obj });
         }
-
         objects.push_back(obj);
     }
 
@@ -132,6 +659,44 @@ bool SceneSerializer::LoadScene(const std::string& filepath,
     return true;
 }
 
+bool SceneSerializer::PatchScene(const std::string& filepath,
+                                  std::vector<std::shared_ptr<GameObject>>& objects,
+                                  SceneFingerprint& fingerprint, ScenePatch* patch) {
+    MOLGA_PROFILE("SceneSerializer::PatchScene");
+
+    ScenePatch result;
+
+    if (IsBinaryScene(filepath)) {
+        BinaryScene scene;
+        if (!scene.Open(filepath)) {
+            return false;
+        }
+        PatchObjects(scene.GetObjectCount(),
+                     [&scene](size_t i) { return scene.HashObject(static_cast<uint32_t>(i)); },
+                     [&scene](size_t i) { return scene.CreateObject(static_cast<uint32_t>(i)); },
+                     objects, fingerprint, result);
+    } else {
+        json sceneJson;
+        if (!ReadSceneJson(filepath, sceneJson)) {
+            return false;
+        }
+        const json& records = sceneJson["gameObjects"];
+        PatchObjects(records.size(),
+                     [&records](size_t i) { return HashJsonObject(records[i]); },
+                     [&records](size_t i) { return ObjectFromJson(records[i]); },
+                     objects, fingerprint, result);
+    }
+
+    std::cout << "[SceneSerializer] Scene patched from: " << filepath
+              << " (" << result.replaced << " replaced, " << result.added << " added, "
+              << result.removed << " removed, " << result.unchanged << " unchanged)" << std::endl;
+
+    if (patch) {
+        *patch = std::move(result);
+    }
+    return true;
+}
+
 std::string SceneSerializer::SerializeGameObject(const GameObject* obj) {
     if (!obj) return "{}";
 
@@ -165,27 +730,5 @@ std::shared_ptr<GameObject> SceneSerializer::DeserializeGameObject(const std::st
         return nullptr;
     }
 
-    std::string name = objJson.value("name", "GameObject");
-    auto obj = std::make_shared<GameObject>(name);
-    obj->SetActive(objJson.value("active", true));
-
-    auto& factories = GetComponentFactories();
-
-    if (objJson.contains("components")) {
-        for (const auto& compJson : objJson["components"]) {
-            std::string type = compJson.value("type", "");
-
-            auto factoryIt = factories.find(type);
-            if (factoryIt != factories.end()) {
-                Component* comp = factoryIt->second(obj.get());
-                if (comp) {
-                    comp->Deserialize(compJson);
-                }
-            } else {
-                std::cerr << "[SceneSerializer] Unknown component type: " << type << std::endl;
-            }
-        }
-    }
-
-    return obj;
+    return ObjectFromJson(objJson);
 }
@@ -1,21 +1,73 @@
 #ifndef MOLGA_SCENE_SERIALIZER_H
 #define MOLGA_SCENE_SERIALIZER_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 
 class GameObject;
 
+// What was loaded from (or saved to) a scene file: per object record, in
+// file order, a hash of the record's contents and the object made from it.
+// PatchScene compares the file against it to find the records that changed.
+struct SceneRecord {
+    uint64_t hash = 0;
+    std::weak_ptr<GameObject> object;
+};
+using SceneFingerprint = std::vector<SceneRecord>;
+
+struct ScenePatch {
+    int unchanged = 0;
+    int replaced = 0;           // Record edited: object rebuilt in its slot
+    int added = 0;
+    int removed = 0;
+    std::vector<GameObject*> created;   // Replaced and added objects
+};
+
+// Scenes are stored as JSON (.json, diff-friendly, used in source control)
+// or as a binary .mscene file for fast loading. The binary file is a
+// versioned header followed by a type table, an object table, a component
+// table, a string region and the component data. It is memory-mapped on
+// load and the tables are read in place.
 class SceneSerializer {
 public:
-    // Save scene to JSON file
+    static constexpr const char* BINARY_EXTENSION = ".mscene";
+    static constexpr uint32_t BINARY_VERSION = 1;
+
+    // Save scene (binary if the path ends in .mscene, JSON otherwise)
     static bool SaveScene(const std::string& filepath,
-                          const std::vector<std::shared_ptr<GameObject>>& objects);
+                          const std::vector<std::shared_ptr<GameObject>>& objects,
+                          SceneFingerprint* fingerprint = nullptr);
 
-    // Load scene from JSON file
+    // Load scene (binary if the path ends in .mscene, JSON otherwise)
     static bool LoadScene(const std::string& filepath,
-                          std::vector<std::shared_ptr<GameObject>>& objects);
+                          std::vector<std::shared_ptr<GameObject>>& objects,
+                          SceneFingerprint* fingerprint = nullptr);
+
+    // Binary .mscene format
+    static bool SaveSceneBinary(const std::string& filepath,
+                                const std::vector<std::shared_ptr<GameObject>>& objects,
+                                SceneFingerprint* fingerprint = nullptr);
+    static bool LoadSceneBinary(const std::string& filepath,
+                                std::vector<std::shared_ptr<GameObject>>& objects,
+                                SceneFingerprint* fingerprint = nullptr);
+
+    // Apply a changed scene file to objects loaded from it earlier, touching
+    // only the objects whose records changed: records that are unchanged
+    // (wherever they moved in the file) keep their objects and runtime
+    // state, an edited record rebuilds its object in the same slot of
+    // objects, new records are appended and objects of deleted records are
+    // removed. Objects not from the file are left alone. Record ids are not
+    // compared, so a scene saved again unchanged is a no-op.
+    static bool PatchScene(const std::string& filepath,
+                           std::vector<std::shared_ptr<GameObject>>& objects,
+                           SceneFingerprint& fingerprint, ScenePatch* patch = nullptr);
+
+    // Convert between JSON and .mscene; each format is picked by extension
+    static bool ConvertScene(const std::string& inputPath, const std::string& outputPath);
+
+    static bool IsBinaryScene(const std::string& filepath);
 
     // Serialize single GameObject to JSON string
     static std::string SerializeGameObject(const GameObject* obj);
@@ -0,0 +1,102 @@
+#include "SimulationLoop.h"
+#include "../ECS/GameObject.h"
+#include "../ECS/Components/Transform.h"
+#include "../Physics/PhysicsWorld.h"
+#include "Profiler.h"
+#include <cmath>
+#include <iostream>
+
+SimulationLoop& SimulationLoop::Get() {
+    static SimulationLoop instance;
+    return instance;
+}
+
+void SimulationLoop::SetSettings(const SimulationSettings& value) {
+    settings = value;
+
+    if (settings.fixedDeltaTime <= 0.0f) {
+        std::cerr << "[SimulationLoop] Invalid fixed delta time " << settings.fixedDeltaTime
+                  << ", using 1/60" << std::endl;
+        settings.fixedDeltaTime = 1.0f / 60.0f;
+    }
+    if (settings.maxSubSteps < 1) {
+        settings.maxSubSteps = 1;
+    }
+
+    Reset();
+}
+
+void SimulationLoop::Tick(float deltaTime, const std::vector<std::shared_ptr<GameObject>>& objects) {
+    const double fixedDt = settings.fixedDeltaTime;
+    accumulator += deltaTime;
+
+    // Phase 1: fixed steps
+    int steps = 0;
+    while (accumulator >= fixedDt && steps < settings.maxSubSteps) {
+        MOLGA_PROFILE("FixedUpdate");
+
+        if (settings.interpolate) {
+            Transform::SaveFixedStates();
+        }
+
+        for (auto& obj : objects) {
+            if (obj && obj->IsActive()) {
+                obj->FixedUpdate(settings.fixedDeltaTime);
+            }
+        }
+
+        // Collision detection and script callbacks
+        PhysicsWorld::Get().Step();
+
+        if (settings.interpolate) {
+            Transform::SaveFixedMotion();
+        }
+
+        accumulator -= fixedDt;
+        steps++;
+    }
+
+    // Spiral-of-death guard: drop whole steps we had no budget for
+    if (accumulator >= fixedDt) {
+        double excess = accumulator - std::fmod(accumulator, fixedDt);
+        droppedTime += excess;
+        accumulator -= excess;
+    }
+
+    stepsLastFrame = steps;
+    totalSteps += steps;
+
+    // Phase 2: variable update
+    {
+        MOLGA_PROFILE("Update");
+        for (auto& obj : objects) {
+            if (obj && obj->IsActive()) {
+                obj->Update(deltaTime);
+            }
+        }
+    }
+
+    // Phase 3: late update (cameras, follow logic)
+    {
+        MOLGA_PROFILE("LateUpdate");
+        for (auto& obj : objects) {
+            if (obj && obj->IsActive()) {
+                obj->LateUpdate(deltaTime);
+            }
+        }
+    }
+
+    alpha = settings.interpolate ? static_cast<float>(accumulator / fixedDt) : 1.0f;
+    Transform::SetInterpolationAlpha(alpha);
+}
+
+void SimulationLoop::Reset() {
+    accumulator = 0.0;
+    alpha = 1.0f;
+    stepsLastFrame = 0;
+    Transform::SetInterpolationAlpha(1.0f);
+
+    // No fixed motion left over to blend in once the loop runs again
+    Transform::SaveFixedStates();
+    Transform::SaveFixedMotion();
+}
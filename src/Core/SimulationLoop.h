@@ -0,0 +1,59 @@
+#ifndef MOLGA_SIMULATION_LOOP_H
+#define MOLGA_SIMULATION_LOOP_H
+
+#include <vector>
+#include <memory>
+
+class GameObject;
+
+struct SimulationSettings {
+    float fixedDeltaTime = 1.0f / 60.0f;    // Seconds per fixed step
+    int maxSubSteps = 5;                    // Fixed steps allowed per frame
+    bool interpolate = true;                // Blend transforms between steps when rendering
+};
+
+// Drives game objects through the frame phases:
+//   1. FixedUpdate + PhysicsWorld::Step, zero or more times at a fixed rate
+//   2. Update, once with the frame delta
+//   3. LateUpdate, once with the frame delta
+// Frame time is accumulated and consumed in fixed steps, so simulation runs
+// at the same rate regardless of the render rate. When a frame would need
+// more than maxSubSteps steps, the excess time is dropped rather than
+// letting slow frames cause ever more steps.
+class SimulationLoop {
+public:
+    static SimulationLoop& Get();
+
+    void SetSettings(const SimulationSettings& value);
+    const SimulationSettings& GetSettings() const { return settings; }
+
+    // Run all phases for one frame
+    void Tick(float deltaTime, const std::vector<std::shared_ptr<GameObject>>& objects);
+
+    // Forget accumulated time and render transforms at their current state
+    // (e.g. when the simulation is stopped or paused)
+    void Reset();
+
+    // Blend factor between the previous and current fixed state (0..1)
+    float GetInterpolationAlpha() const { return alpha; }
+
+    // Stats
+    int GetStepsLastFrame() const { return stepsLastFrame; }
+    long long GetTotalSteps() const { return totalSteps; }
+    double GetDroppedTime() const { return droppedTime; }
+
+private:
+    SimulationLoop() = default;
+    SimulationLoop(const SimulationLoop&) = delete;
+    SimulationLoop& operator=(const SimulationLoop&) = delete;
+
+    SimulationSettings settings;
+    double accumulator = 0.0;
+    float alpha = 1.0f;
+
+    int stepsLastFrame = 0;
+    long long totalSteps = 0;
+    double droppedTime = 0.0;
+};
+
+#endif // MOLGA_SIMULATION_LOOP_H
@@ -0,0 +1,139 @@
+#include "TextureAtlas.h"
+#include "../Texture.h"
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+// Private copy of stb_rect_pack (Font and ImGui build their own); the parts
+// we don't call would warn as unused
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#define STBRP_STATIC
+#include "../../external/imgui/imstb_rectpack.h"
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+TextureAtlas::TextureAtlas(int pageSize, int padding)
+    : pageSize(pageSize), padding(padding) {
+}
+
+TextureAtlas::~TextureAtlas() = default;
+
+bool TextureAtlas::Add(const std::string& name, int width, int height, const unsigned char* pixels) {
+    if (!pixels || width <= 0 || height <= 0) return false;
+
+    if (width + padding * 2 > pageSize || height + padding * 2 > pageSize) {
+        std::cerr << "[TextureAtlas] Image too large for a " << pageSize << " page: " << name << std::endl;
+        return false;
+    }
+
+    PendingImage image;
+    image.name = name;
+    image.width = width;
+    image.height = height;
+    image.pixels.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+    pending.push_back(std::move(image));
+    return true;
+}
+
+void TextureAtlas::Blit(std::vector<unsigned char>& page, const PendingImage& image, int x, int y) const {
+    // Copy the image and extrude its edge pixels into the padding so linear
+    // filtering at the border never samples a neighbouring image
+    for (int py = -padding; py < image.height + padding; py++) {
+        int srcY = std::min(std::max(py, 0), image.height - 1);
+        unsigned char* dst = &page[(static_cast<size_t>(y + py) * pageSize + (x - padding)) * 4];
+
+        for (int px = -padding; px < image.width + padding; px++) {
+            int srcX = std::min(std::max(px, 0), image.width - 1);
+            std::memcpy(dst, &image.pixels[(static_cast<size_t>(srcY) * image.width + srcX) * 4], 4);
+            dst += 4;
+        }
+    }
+}
+
+bool TextureAtlas::Build() {
+    if (pending.empty()) return true;
+
+    std::vector<stbrp_rect> rects(pending.size());
+    for (size_t i = 0; i < pending.size(); i++) {
+        rects[i].id = static_cast<int>(i);
+        rects[i].w = pending[i].width + padding * 2;
+        rects[i].h = pending[i].height + padding * 2;
+        rects[i].was_packed = 0;
+    }
+
+    std::vector<stbrp_node> nodes(pageSize);
+    std::vector<stbrp_rect> remaining = rects;
+
+    while (!remaining.empty()) {
+        stbrp_context context;
+        stbrp_init_target(&context, pageSize, pageSize, nodes.data(), static_cast<int>(nodes.size()));
+        stbrp_pack_rects(&context, remaining.data(), static_cast<int>(remaining.size()));
+
+        std::vector<unsigned char> pixels(static_cast<size_t>(pageSize) * pageSize * 4, 0);
+        std::vector<stbrp_rect> unpacked;
+        std::vector<const stbrp_rect*> packed;
+
+        for (const stbrp_rect& rect : remaining) {
+            if (rect.was_packed) {
+                packed.push_back(&rect);
+            } else {
+                unpacked.push_back(rect);
+            }
+        }
+
+        // Every image fits an empty page (checked in Add), so this can't loop forever
+        if (packed.empty()) {
+            std::cerr << "[TextureAtlas] Failed to pack " << remaining.size() << " images" << std::endl;
+            break;
+        }
+
+        for (const stbrp_rect* rect : packed) {
+            Blit(pixels, pending[rect->id], rect->x + padding, rect->y + padding);
+        }
+
+        auto page = std::make_unique<Texture>(pageSize, pageSize, pixels.data(), 4);
+        Texture* texture = page.get();
+        pages.push_back(std::move(page));
+
+        float invSize = 1.0f / static_cast<float>(pageSize);
+        for (const stbrp_rect* rect : packed) {
+            const PendingImage& image = pending[rect->id];
+            int x = rect->x + padding;
+            int y = rect->y + padding;
+
+            AtlasRegion region;
+            region.texture = texture;
+            region.frame = Frame(x * invSize, y * invSize,
+                                 (x + image.width) * invSize, (y + image.height) * invSize);
+            region.width = image.width;
+            region.height = image.height;
+            regions[image.name] = region;
+        }
+
+        remaining.swap(unpacked);
+    }
+
+    std::cout << "[TextureAtlas] Packed " << pending.size() << " images into "
+              << pages.size() << " page(s)" << std::endl;
+
+    pending.clear();
+    return remaining.empty();
+}
+
+const AtlasRegion* TextureAtlas::GetRegion(const std::string& name) const {
+    auto it = regions.find(name);
+    return it != regions.end() ? &it->second : nullptr;
+}
+
+void TextureAtlas::Clear() {
+    pending.clear();
+    regions.clear();
+    pages.clear();
+}
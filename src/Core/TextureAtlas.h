@@ -0,0 +1,69 @@
+#ifndef MOLGA_TEXTURE_ATLAS_H
+#define MOLGA_TEXTURE_ATLAS_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include "../Common/Types.h"
+
+class Texture;
+
+// A sub-rectangle of an atlas page (or a whole standalone texture)
+struct AtlasRegion {
+    Texture* texture = nullptr;
+    Frame frame;            // UV rect inside texture, same convention as SpriteSheet
+    int width = 0;          // Size in pixels
+    int height = 0;
+
+    bool IsValid() const { return texture != nullptr; }
+};
+
+// Packs many small RGBA images into a few large pages (imstb_rectpack) so
+// sprites that use different images can still share one texture and batch.
+class TextureAtlas {
+public:
+    explicit TextureAtlas(int pageSize = 2048, int padding = 1);
+    ~TextureAtlas();
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // Queue an image for packing. Pixels are RGBA8, bottom row first (as
+    // loaded with stbi_set_flip_vertically_on_load); the atlas copies them.
+    bool Add(const std::string& name, int width, int height, const unsigned char* pixels);
+
+    // Pack everything added since the last Build into new pages and upload
+    // them. Images larger than a page are skipped.
+    bool Build();
+
+    // Region by name, or nullptr if the image was not packed
+    const AtlasRegion* GetRegion(const std::string& name) const;
+    bool Contains(const std::string& name) const { return regions.count(name) > 0; }
+
+    int GetPageCount() const { return static_cast<int>(pages.size()); }
+    int GetPageSize() const { return pageSize; }
+    // Only affects pages created by later Build calls
+    void SetPageSize(int size) { pageSize = size; }
+    size_t GetRegionCount() const { return regions.size(); }
+
+    void Clear();
+
+private:
+    struct PendingImage {
+        std::string name;
+        int width;
+        int height;
+        std::vector<unsigned char> pixels;
+    };
+
+    void Blit(std::vector<unsigned char>& page, const PendingImage& image, int x, int y) const;
+
+    int pageSize;
+    int padding;
+    std::vector<PendingImage> pending;
+    std::vector<std::unique_ptr<Texture>> pages;
+    std::unordered_map<std::string, AtlasRegion> regions;
+};
+
+#endif // MOLGA_TEXTURE_ATLAS_H
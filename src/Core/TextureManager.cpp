@@ -1,8 +1,13 @@
 #include "TextureManager.h"
 #include "../Texture.h"
+#include "../RenderBackend.h"
 #include "Project.h"
+#include "Profiler.h"
+#include "../Common/PathUtil.h"
 #include <iostream>
 #include <filesystem>
+#include <chrono>
+#include "stb_image.h"
 
 namespace fs = std::filesystem;
 
@@ -11,6 +16,16 @@ TextureManager& TextureManager::Get() {
     return instance;
 }
 
+TextureManager::TextureManager() {
+    // Decode jobs may still be queued when we are destroyed, so the job
+    // system must be destroyed after us
+    JobSystem::Get();
+}
+
+TextureManager::~TextureManager() {
+    CancelDecodes();
+}
+
 Texture* TextureManager::Load(const std::string& path) {
     if (path.empty()) {
         return nullptr;
@@ -23,10 +38,7 @@ Texture* TextureManager::Load(const std::string& path) {
     }
 
     // Resolve path (could be relative to project)
-    std::string absolutePath = path;
-    if (!fs::path(path).is_absolute() && Project::Get().IsOpen()) {
-        absolutePath = Project::Get().GetAbsolutePath(path);
-    }
+    std::string absolutePath = ResolvePath(path);
 
     // Check if file exists
     if (!fs::exists(absolutePath)) {
@@ -39,6 +51,7 @@ Texture* TextureManager::Load(const std::string& path) {
         auto texture = std::make_unique<Texture>(absolutePath.c_str());
         Texture* ptr = texture.get();
         textures[path] = std::move(texture);
+        AddFileKey(path, absolutePath);
 
         std::cout << "[TextureManager] Loaded texture: " << path << std::endl;
         return ptr;
@@ -48,6 +61,258 @@ Texture* TextureManager::Load(const std::string& path) {
     }
 }
 
+Texture* TextureManager::LoadAsync(const std::string& path) {
+    if (path.empty()) {
+        return nullptr;
+    }
+
+    auto it = textures.find(path);
+    if (it != textures.end()) {
+        return it->second.get();
+    }
+
+    // Nothing to upload, and Load only reads the image header
+    if (RenderBackend::IsNull()) {
+        return Load(path);
+    }
+
+    std::string absolutePath = ResolvePath(path);
+    if (!fs::exists(absolutePath)) {
+        std::cerr << "[TextureManager] File not found: " << absolutePath << std::endl;
+        return nullptr;
+    }
+
+    // Magenta/black checker until the real image arrives
+    static const unsigned char placeholder[2 * 2 * 4] = {
+        255, 0, 255, 255,   0, 0, 0, 255,
+        0, 0, 0, 255,       255, 0, 255, 255
+    };
+    auto texture = std::make_unique<Texture>(2, 2, placeholder, 4);
+    Texture* ptr = texture.get();
+    textures[path] = std::move(texture);
+    AddFileKey(path, absolutePath);
+
+    // The header is enough for the size, so layout doesn't wait for the decode
+    PendingLoad& load = pending[path];
+    load.generation = nextGeneration++;
+    int channels = 0;
+    stbi_info(absolutePath.c_str(), &load.width, &load.height, &channels);
+    QueueDecode(path, load.generation);
+
+    return ptr;
+}
+
+void TextureManager::Update(double uploadBudgetMs) {
+    if (pending.empty()) return;
+
+    MOLGA_PROFILE("TextureManager::Update");
+
+    auto start = std::chrono::steady_clock::now();
+    while (true) {
+        DecodedImage image;
+        {
+            std::lock_guard<std::mutex> lock(decodedMutex);
+            if (decoded.empty()) break;
+            image = std::move(decoded.back());
+            decoded.pop_back();
+        }
+
+        // The texture may have been unloaded or reloaded again while it was
+        // being decoded
+        auto it = textures.find(image.path);
+        auto pendingIt = pending.find(image.path);
+        if (it != textures.end() && pendingIt != pending.end() && pendingIt->second.generation == image.generation) {
+            pending.erase(pendingIt);
+            if (image.pixels) {
+                it->second->Upload(image.width, image.height, image.pixels, image.channels);
+                std::cout << "[TextureManager] Loaded texture: " << image.path << std::endl;
+            } else {
+                std::cerr << "[TextureManager] Failed to load texture: " << image.path << std::endl;
+            }
+        }
+        if (image.pixels) {
+            stbi_image_free(image.pixels);
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= uploadBudgetMs) break;
+    }
+}
+
+bool TextureManager::Reload(const std::string& path) {
+    std::vector<std::string> keys;
+    if (textures.find(path) != textures.end()) {
+        keys.push_back(path);
+    } else {
+        auto range = keysByFile.equal_range(PathUtil::Normalize(ResolvePath(path)));
+        for (auto it = range.first; it != range.second; ++it) {
+            keys.push_back(it->second);
+        }
+    }
+    if (keys.empty()) return false;
+
+    // Nothing was uploaded in the first place
+    if (RenderBackend::IsNull()) return true;
+
+    for (const std::string& key : keys) {
+        // A decode already in flight may have read the old file; only this
+        // one's image is uploaded
+        PendingLoad& load = pending[key];
+        load = PendingLoad();
+        load.generation = nextGeneration++;
+        QueueDecode(key, load.generation);
+        std::cout << "[TextureManager] Reloading texture: " << key << std::endl;
+    }
+    return true;
+}
+
+bool TextureManager::IsPending(const std::string& path) const {
+    return pending.find(path) != pending.end();
+}
+
+TextureManager::DecodedImage TextureManager::Decode(const std::string& path, const std::string& absolutePath,
+                                                   int desiredChannels) {
+    MOLGA_PROFILE("DecodeTexture");
+
+    // Textures are stored bottom-up, matching Texture(const char*)
+    stbi_set_flip_vertically_on_load_thread(1);
+
+    DecodedImage image;
+    image.path = path;
+    image.pixels = stbi_load(absolutePath.c_str(), &image.width, &image.height, &image.channels, desiredChannels);
+    if (image.pixels && desiredChannels != 0) {
+        image.channels = desiredChannels;
+    }
+    return image;
+}
+
+void TextureManager::QueueDecode(const std::string& path, unsigned int generation) {
+    struct Request {
+        std::string path;
+        std::string absolutePath;
+        unsigned int generation;
+    };
+    // Jobs store small callables inline; the strings go on the heap
+    Request* request = new Request{ path, ResolvePath(path), generation };
+
+    JobSystem::Get().Run([this, request] {
+        if (!cancelDecodes.load(std::memory_order_relaxed)) {
+            DecodedImage image = Decode(request->path, request->absolutePath, 0);
+            image.generation = request->generation;
+
+            std::lock_guard<std::mutex> lock(decodedMutex);
+            decoded.push_back(std::move(image));
+        }
+        delete request;
+    }, &decodeJobs);
+}
+
+void TextureManager::CancelDecodes() {
+    if (!decodeJobs.IsDone()) {
+        cancelDecodes = true;
+        JobSystem::Get().Wait(decodeJobs);
+        cancelDecodes = false;
+    }
+
+    std::lock_guard<std::mutex> lock(decodedMutex);
+    for (auto& image : decoded) {
+        if (image.pixels) stbi_image_free(image.pixels);
+    }
+    decoded.clear();
+}
+
+std::vector<TextureManager::DecodedImage> TextureManager::DecodeAll(const std::vector<std::string>& paths,
+                                                                    int desiredChannels) {
+    // Resolved here: the project is not safe to read from jobs
+    std::vector<std::string> absolutePaths;
+    absolutePaths.reserve(paths.size());
+    for (const std::string& path : paths) {
+        absolutePaths.push_back(ResolvePath(path));
+    }
+
+    // One image per job: decode times vary too much to group them
+    std::vector<DecodedImage> results(paths.size());
+    JobSystem::Get().ParallelFor(paths.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            results[i] = Decode(paths[i], absolutePaths[i], desiredChannels);
+        }
+    });
+    return results;
+}
+
+void TextureManager::AddFileKey(const std::string& path, const std::string& absolutePath) {
+    keysByFile.emplace(PathUtil::Normalize(absolutePath), path);
+}
+
+void TextureManager::RemoveFileKey(const std::string& path) {
+    auto range = keysByFile.equal_range(PathUtil::Normalize(ResolvePath(path)));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == path) {
+            keysByFile.erase(it);
+            return;
+        }
+    }
+}
+
+std::string TextureManager::ResolvePath(const std::string& path) const {
+    if (!fs::path(path).is_absolute() && Project::Get().IsOpen()) {
+        return Project::Get().GetAbsolutePath(path);
+    }
+    return path;
+}
+
+bool TextureManager::BuildAtlas(const std::vector<std::string>& paths, int pageSize) {
+    // Atlas pages only matter for drawing; sprites fall back to plain textures
+    if (RenderBackend::IsNull()) return true;
+
+    atlas.SetPageSize(pageSize);
+
+    std::vector<std::string> toDecode;
+    std::unordered_set<std::string> seen;
+    for (const auto& path : paths) {
+        if (path.empty() || atlas.Contains(path)) continue;
+        if (seen.insert(path).second) {
+            toDecode.push_back(path);
+        }
+    }
+
+    // Decode on the worker pool; only the packing below is serial
+    std::vector<DecodedImage> images = DecodeAll(toDecode, 4);
+
+    int added = 0;
+    for (auto& image : images) {
+        if (!image.pixels) {
+            std::cerr << "[TextureManager] Failed to load image for atlas: " << ResolvePath(image.path) << std::endl;
+            continue;
+        }
+
+        if (atlas.Add(image.path, image.width, image.height, image.pixels)) {
+            added++;
+        }
+        stbi_image_free(image.pixels);
+    }
+
+    if (added == 0) return true;
+    return atlas.Build();
+}
+
+AtlasRegion TextureManager::GetRegion(const std::string& path) {
+    if (const AtlasRegion* region = atlas.GetRegion(path)) {
+        return *region;
+    }
+
+    AtlasRegion region;
+    region.texture = LoadAsync(path);
+    if (region.texture) {
+        // Still showing the placeholder: use the size of the real image
+        auto it = pending.find(path);
+        bool sizeKnown = it != pending.end() && it->second.width > 0;
+        region.width = sizeKnown ? it->second.width : region.texture->GetWidth();
+        region.height = sizeKnown ? it->second.height : region.texture->GetHeight();
+    }
+    return region;
+}
+
 Texture* TextureManager::Get(const std::string& path) {
     auto it = textures.find(path);
     if (it != textures.end()) {
@@ -64,11 +329,18 @@ void TextureManager::Unload(const std::string& path) {
     auto it = textures.find(path);
     if (it != textures.end()) {
         textures.erase(it);
+        pending.erase(path);
+        RemoveFileKey(path);
         std::cout << "[TextureManager] Unloaded texture: " << path << std::endl;
     }
 }
 
 void TextureManager::Clear() {
+    // Drop queued and in-flight decodes before their textures go away
+    CancelDecodes();
+    pending.clear();
     textures.clear();
+    keysByFile.clear();
+    atlas.Clear();
     std::cout << "[TextureManager] Cleared all textures" << std::endl;
 }
@@ -4,6 +4,12 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include "TextureAtlas.h"
+#include "JobSystem.h"
 
 class Texture;
 
@@ -14,6 +20,27 @@ public:
     // Load texture (cached)
     Texture* Load(const std::string& path);
 
+    // Start loading a texture in the background (cached). Returns a texture
+    // showing a placeholder image right away; the decoded image is uploaded
+    // into the same Texture* by a later Update(). Images are decoded by
+    // JobSystem jobs (inline when it is not running).
+    Texture* LoadAsync(const std::string& path);
+
+    // Upload decoded images on the main (GL) thread. Stops once the budget is
+    // used up, but always uploads at least one image so loading makes progress.
+    void Update(double uploadBudgetMs = 2.0);
+
+    // Re-read a loaded texture after its file changed. The image is decoded
+    // in the background and a later Update() uploads it into the same
+    // Texture*, so holders keep their pointer; the old image shows until
+    // then. path is the cache key or the file's path. False if no texture
+    // was loaded from it (atlas images are not reloaded).
+    bool Reload(const std::string& path);
+
+    // True while the texture is still waiting to be decoded or uploaded
+    bool IsPending(const std::string& path) const;
+    size_t GetPendingCount() const { return pending.size(); }
+
     // Get already loaded texture
     Texture* Get(const std::string& path);
 
@@ -29,12 +56,72 @@ public:
     // Get texture count
     size_t GetCount() const { return textures.size(); }
 
+    // Pack the given images into shared atlas pages. Afterwards GetRegion
+    // returns the atlas region for these paths instead of a standalone texture.
+    bool BuildAtlas(const std::vector<std::string>& paths, int pageSize = 2048);
+
+    // Region for an image: its atlas region if packed, otherwise the whole
+    // standalone texture. That one is loaded asynchronously and shows the
+    // placeholder until uploaded (IsPending), but the region already has the
+    // image's size, read from the file header. Invalid if the file doesn't
+    // exist.
+    AtlasRegion GetRegion(const std::string& path);
+
+    TextureAtlas& GetAtlas() { return atlas; }
+
 private:
-    TextureManager() = default;
+    // Resolve a path that may be relative to the open project
+    std::string ResolvePath(const std::string& path) const;
+
+    struct DecodedImage {
+        std::string path;
+        unsigned char* pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        unsigned int generation = 0;
+    };
+
+    struct PendingLoad {
+        unsigned int generation = 0;    // Of the latest load or reload
+        int width = 0;                  // From the file header; 0 on reload
+        int height = 0;
+    };
+
+    static DecodedImage Decode(const std::string& path, const std::string& absolutePath, int desiredChannels);
+
+    // Decode path on the JobSystem; Update() uploads the result
+    void QueueDecode(const std::string& path, unsigned int generation);
+
+    // Wait for queued decodes, dropping the ones not started yet
+    void CancelDecodes();
+
+    // Decode all images on the JobSystem and wait for them
+    std::vector<DecodedImage> DecodeAll(const std::vector<std::string>& paths, int desiredChannels);
+
+    TextureManager();
+    ~TextureManager();
     TextureManager(const TextureManager&) = delete;
     TextureManager& operator=(const TextureManager&) = delete;
 
     std::unordered_map<std::string, std::unique_ptr<Texture>> textures;
+    TextureAtlas atlas;
+
+    // Cache keys by normalized file path, for Reload with a path from disk
+    std::unordered_multimap<std::string, std::string> keysByFile;
+    void AddFileKey(const std::string& path, const std::string& absolutePath);
+    void RemoveFileKey(const std::string& path);
+
+    // Background decodes. Finished images are handed back through decoded.
+    JobCounter decodeJobs;
+    std::atomic<bool> cancelDecodes{false};
+    std::vector<DecodedImage> decoded;
+    std::mutex decodedMutex;
+
+    // Main thread only. Images from a decode older than the pending
+    // generation (superseded by a reload) are dropped.
+    std::unordered_map<std::string, PendingLoad> pending;
+    unsigned int nextGeneration = 1;
 };
 
 #endif // MOLGA_TEXTURE_MANAGER_H
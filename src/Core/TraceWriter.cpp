@@ -0,0 +1,176 @@
+#include "TraceWriter.h"
+#include <iostream>
+
+namespace {
+
+// Zone names are literals, but keep the output valid whatever they contain
+void WriteEscaped(std::FILE* file, const char* text) {
+    for (const char* c = text; *c; c++) {
+        unsigned char ch = static_cast<unsigned char>(*c);
+        if (ch == '"' || ch == '\\') {
+            std::fputc('\\', file);
+            std::fputc(ch, file);
+        } else if (ch < 0x20) {
+            std::fprintf(file, "\\u%04x", ch);
+        } else {
+            std::fputc(ch, file);
+        }
+    }
+}
+
+} // namespace
+
+TraceWriter& TraceWriter::Get() {
+    static TraceWriter instance;
+    return instance;
+}
+
+TraceWriter::TraceWriter() {
+    // Construct the Profiler first so it outlives us during static destruction
+    Profiler::Get();
+}
+
+TraceWriter::~TraceWriter() {
+    Stop();
+}
+
+bool TraceWriter::Start(const std::string& filepath) {
+    if (recording) {
+        std::cerr << "[TraceWriter] Already recording to " << path << std::endl;
+        return false;
+    }
+
+    file = std::fopen(filepath.c_str(), "wb");
+    if (!file) {
+        std::cerr << "[TraceWriter] Failed to open " << filepath << std::endl;
+        return false;
+    }
+
+    path = filepath;
+    namedThreads.clear();
+    eventCount = 0;
+    stopping = false;
+
+    std::fputs("[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Molga Engine\"}}", file);
+
+    writer = std::thread(&TraceWriter::WriterLoop, this);
+    recording = true;
+
+    enabledProfiler = !Profiler::IsEnabled();
+    if (enabledProfiler) {
+        Profiler::Get().SetEnabled(true);
+    }
+
+    std::cout << "[TraceWriter] Recording to " << path << std::endl;
+    return true;
+}
+
+void TraceWriter::Stop() {
+    if (!recording) return;
+    recording = false;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    batchReady.notify_one();
+    writer.join();
+
+    std::fputs("\n]\n", file);
+    std::fclose(file);
+    file = nullptr;
+    queue.clear();
+    spare.clear();
+
+    if (enabledProfiler) {
+        Profiler::Get().SetEnabled(false);
+        enabledProfiler = false;
+    }
+
+    std::cout << "[TraceWriter] Wrote " << eventCount << " events to " << path << std::endl;
+}
+
+void TraceWriter::SubmitFrame(const ProfileFrame& frame) {
+    if (!recording) return;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        Batch batch;
+        if (!spare.empty()) {
+            batch = std::move(spare.back());
+            spare.pop_back();
+        }
+        batch.frameIndex = frame.index;
+        batch.startNs = frame.startNs;
+        batch.endNs = frame.endNs;
+        batch.zones.assign(frame.zones.begin(), frame.zones.end());
+        queue.push_back(std::move(batch));
+    }
+    batchReady.notify_one();
+}
+
+void TraceWriter::WriterLoop() {
+    std::vector<Batch> batches;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            batchReady.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) break;   // Stopping and drained
+            batches.swap(queue);
+        }
+
+        for (const auto& batch : batches) {
+            WriteBatch(batch);
+        }
+        std::fflush(file);
+
+        std::lock_guard<std::mutex> lock(queueMutex);
+        for (auto& batch : batches) {
+            batch.zones.clear();
+            spare.push_back(std::move(batch));
+        }
+        batches.clear();
+    }
+}
+
+void TraceWriter::WriteBatch(const Batch& batch) {
+    // The frame itself, on the main thread's track
+    WriteEvent("Frame", "frame", 0, batch.startNs, batch.endNs);
+    std::fprintf(file, ",\"args\":{\"index\":%llu}}", static_cast<unsigned long long>(batch.frameIndex));
+
+    for (const auto& zone : batch.zones) {
+        WriteEvent(zone.name, "engine", zone.threadIndex, zone.startNs, zone.endNs);
+        std::fputc('}', file);
+    }
+}
+
+// Writes a complete ("X") event, leaving the object open for args
+void TraceWriter::WriteEvent(const char* name, const char* category, uint32_t threadIndex,
+                             uint64_t startNs, uint64_t endNs) {
+    if (threadIndex >= namedThreads.size() || !namedThreads[threadIndex]) {
+        WriteThreadName(threadIndex);
+    }
+
+    std::fputs(",\n{\"name\":\"", file);
+    WriteEscaped(file, name);
+    std::fprintf(file, "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                 category, threadIndex, startNs / 1000.0, (endNs - startNs) / 1000.0);
+    eventCount++;
+}
+
+void TraceWriter::WriteThreadName(uint32_t threadIndex) {
+    if (threadIndex >= namedThreads.size()) {
+        namedThreads.resize(threadIndex + 1, false);
+    }
+    namedThreads[threadIndex] = true;
+
+    std::string name = Profiler::Get().GetThreadName(threadIndex);
+    std::fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", threadIndex);
+    WriteEscaped(file, name.c_str());
+    std::fputs("\"}}", file);
+
+    // Keep the main thread at the top of the timeline
+    std::fprintf(file, ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%u}}",
+                 threadIndex, threadIndex);
+}
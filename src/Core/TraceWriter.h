@@ -0,0 +1,68 @@
+#ifndef MOLGA_TRACE_WRITER_H
+#define MOLGA_TRACE_WRITER_H
+
+#include "Profiler.h"
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Streams profiler zones to a Chrome Trace Event file that opens in
+// chrome://tracing or ui.perfetto.dev. Start() turns on Profiler recording;
+// every Profiler::EndFrame() hands its zones over and a background thread
+// formats and writes them, so the main thread only copies the zone array.
+//
+// The file uses the JSON array format, whose closing bracket is optional,
+// so a capture from a run that crashed or was killed still loads.
+class TraceWriter {
+public:
+    static TraceWriter& Get();
+
+    bool Start(const std::string& path);
+    void Stop();
+    bool IsRecording() const { return recording; }
+    const std::string& GetPath() const { return path; }
+
+    // Called by Profiler::EndFrame (main thread)
+    void SubmitFrame(const ProfileFrame& frame);
+
+private:
+    TraceWriter();
+    ~TraceWriter();
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    struct Batch {
+        uint64_t frameIndex = 0;
+        uint64_t startNs = 0;
+        uint64_t endNs = 0;
+        std::vector<ProfileZone> zones;
+    };
+
+    void WriterLoop();
+    void WriteBatch(const Batch& batch);
+    void WriteEvent(const char* name, const char* category, uint32_t threadIndex,
+                    uint64_t startNs, uint64_t endNs);
+    void WriteThreadName(uint32_t threadIndex);
+
+    std::string path;
+    bool recording = false;
+    bool enabledProfiler = false;   // Whether Start() had to enable the Profiler
+
+    std::thread writer;
+    std::mutex queueMutex;
+    std::condition_variable batchReady;
+    std::vector<Batch> queue;
+    std::vector<Batch> spare;       // Written batches, reused to avoid allocations
+    bool stopping = false;
+
+    // Writer thread only (and Start/Stop while it isn't running)
+    std::FILE* file = nullptr;
+    std::vector<bool> namedThreads;
+    uint64_t eventCount = 0;
+};
+
+#endif // MOLGA_TRACE_WRITER_H
@@ -4,6 +4,7 @@
 #include <string>
 #include <typeinfo>
 #include <nlohmann/json.hpp>
+#include "../Core/BinaryStream.h"
 
 class GameObject;
 
@@ -21,6 +22,12 @@ public:
     // Called every frame
     virtual void Update(float dt) {}
 
+    // Called once per fixed simulation step, before physics
+    virtual void FixedUpdate(float fixedDt) {}
+
+    // Called every frame after all Update calls
+    virtual void LateUpdate(float dt) {}
+
     // Called for rendering (optional)
     virtual void Render() {}
 
@@ -32,6 +39,21 @@ public:
     virtual void Serialize(nlohmann::json& j) const {}
     virtual void Deserialize(const nlohmann::json& j) {}
 
+    // Binary serialization (for .mscene files). The default stores the JSON
+    // form so every component round-trips; override with a compact layout.
+    virtual void SerializeBinary(BinaryWriter& writer) const {
+        nlohmann::json j;
+        Serialize(j);
+        writer.WriteString(j.dump());
+    }
+    virtual void DeserializeBinary(BinaryReader& reader) {
+        std::string_view text = reader.ReadString();
+        nlohmann::json j = nlohmann::json::parse(text.begin(), text.end(), nullptr, false);
+        if (!j.is_discarded()) {
+            Deserialize(j);
+        }
+    }
+
     // Editor Inspector GUI (override in derived classes for custom UI)
     virtual void OnInspectorGUI() {}
 
@@ -50,6 +72,7 @@ protected:
 
 // Macro to help define component type name
 #define COMPONENT_TYPE(TypeName) \
+    using ComponentSelf = TypeName; \
     std::string GetTypeName() const override { return #TypeName; } \
     static std::string StaticTypeName() { return #TypeName; }
 
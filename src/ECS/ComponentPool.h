@@ -0,0 +1,59 @@
+#ifndef MOLGA_COMPONENT_POOL_H
+#define MOLGA_COMPONENT_POOL_H
+
+#include <vector>
+#include <memory>
+#include <new>
+#include <utility>
+
+class Component;
+
+class ComponentPoolBase {
+public:
+    virtual ~ComponentPoolBase() = default;
+    virtual void Destroy(Component* component) = 0;
+};
+
+// Storage for every component of one type. Components live in fixed-size
+// contiguous chunks so their addresses never change (GameObject hands out
+// raw pointers); freed slots are reused before a new chunk is allocated.
+template<typename T>
+class ComponentPool : public ComponentPoolBase {
+public:
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    template<typename... Args>
+    T* Create(Args&&... args) {
+        if (freeSlots.empty()) {
+            AllocateChunk();
+        }
+        Slot* slot = freeSlots.back();
+        freeSlots.pop_back();
+        return new (slot) T(std::forward<Args>(args)...);
+    }
+
+    void Destroy(Component* component) override {
+        T* object = static_cast<T*>(component);
+        object->~T();
+        freeSlots.push_back(reinterpret_cast<Slot*>(object));
+    }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char data[sizeof(T)];
+    };
+
+    void AllocateChunk() {
+        chunks.emplace_back(new Slot[CHUNK_SIZE]);
+        Slot* chunk = chunks.back().get();
+        // Push in reverse so slots are handed out in address order
+        for (size_t i = CHUNK_SIZE; i-- > 0;) {
+            freeSlots.push_back(&chunk[i]);
+        }
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> chunks;
+    std::vector<Slot*> freeSlots;
+};
+
+#endif // MOLGA_COMPONENT_POOL_H
@@ -0,0 +1,35 @@
+#ifndef MOLGA_COMPONENT_TYPE_ID_H
+#define MOLGA_COMPONENT_TYPE_ID_H
+
+#include <bitset>
+#include <cstdint>
+#include <type_traits>
+
+// Small dense integer per component type, assigned without RTTI the first
+// time a type is used. Used to index pools, archetype columns and masks.
+using ComponentTypeId = uint32_t;
+
+constexpr ComponentTypeId MAX_COMPONENT_TYPES = 128;
+constexpr ComponentTypeId INVALID_COMPONENT_TYPE = ~0u;
+
+using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+ComponentTypeId NextComponentTypeId();
+
+template<typename T>
+ComponentTypeId GetComponentTypeId() {
+    static const ComponentTypeId id = NextComponentTypeId();
+    return id;
+}
+
+// A component type is "exact" when it declares COMPONENT_TYPE itself.
+// GetComponent<T> for exact types only needs the type ID lookup; for other
+// types (Script and its subclasses) it also searches by dynamic_cast.
+template<typename T, typename = void>
+struct IsExactComponent : std::false_type {};
+
+template<typename T>
+struct IsExactComponent<T, std::void_t<typename T::ComponentSelf>>
+    : std::is_same<typename T::ComponentSelf, T> {};
+
+#endif // MOLGA_COMPONENT_TYPE_ID_H
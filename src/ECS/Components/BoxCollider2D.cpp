@@ -1,5 +1,6 @@
 #include "BoxCollider2D.h"
 #include "../GameObject.h"
+#include "../../Physics/PhysicsWorld.h"
 #include <nlohmann/json.hpp>
 #ifdef MOLGA_EDITOR
 #include <imgui.h>
@@ -7,6 +8,19 @@
 
 using json = nlohmann::json;
 
+BoxCollider2D::~BoxCollider2D() {
+    // Normally already unregistered by OnDetach
+    PhysicsWorld::Get().Unregister(this);
+}
+
+void BoxCollider2D::OnAttach() {
+    PhysicsWorld::Get().Register(this);
+}
+
+void BoxCollider2D::OnDetach() {
+    PhysicsWorld::Get().Unregister(this);
+}
+
 AABB BoxCollider2D::GetWorldAABB() const {
     AABB aabb;
     aabb.width = size.x;
@@ -51,6 +65,7 @@ void BoxCollider2D::Serialize(nlohmann::json& j) const {
     j["size"] = { size.x, size.y };
     j["offset"] = { offset.x, offset.y };
     j["isTrigger"] = isTrigger;
+    j["layer"] = layer;
 }
 
 void BoxCollider2D::Deserialize(const nlohmann::json& j) {
@@ -63,6 +78,37 @@ void BoxCollider2D::Deserialize(const nlohmann::json& j) {
     if (j.contains("isTrigger")) {
         SetTrigger(j["isTrigger"]);
     }
+    if (j.contains("layer")) {
+        SetLayer(j["layer"]);
+    }
+}
+
+void BoxCollider2D::SerializeBinary(BinaryWriter& writer) const {
+    writer.Write(size.x);
+    writer.Write(size.y);
+    writer.Write(offset.x);
+    writer.Write(offset.y);
+    writer.Write(static_cast<uint8_t>(isTrigger ? 1 : 0));
+    writer.Write(static_cast<uint8_t>(layer));
+}
+
+void BoxCollider2D::DeserializeBinary(BinaryReader& reader) {
+    float w = reader.Read<float>();
+    float h = reader.Read<float>();
+    float ox = reader.Read<float>();
+    float oy = reader.Read<float>();
+    uint8_t trigger = reader.Read<uint8_t>();
+    if (!reader.IsOk()) return;
+
+    SetSize(w, h);
+    SetOffset(ox, oy);
+    SetTrigger(trigger != 0);
+
+    // Added later; scenes saved before have no layer byte
+    uint8_t savedLayer = reader.Read<uint8_t>();
+    if (reader.IsOk()) {
+        SetLayer(savedLayer);
+    }
 }
 
 void BoxCollider2D::OnInspectorGUI() {
@@ -81,5 +127,10 @@ void BoxCollider2D::OnInspectorGUI() {
     if (ImGui::Checkbox("Is Trigger", &trigger)) {
         SetTrigger(trigger);
     }
+
+    int layerValue = layer;
+    if (ImGui::SliderInt("Layer", &layerValue, 0, MAX_LAYERS - 1)) {
+        SetLayer(layerValue);
+    }
 #endif
 }
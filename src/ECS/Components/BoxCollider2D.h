@@ -4,6 +4,7 @@
 #include "../Component.h"
 #include "Transform.h"
 #include "../../Collision.h"
+#include <cstdint>
 
 class BoxCollider2D : public Component {
 public:
@@ -11,6 +12,7 @@ public:
 
     BoxCollider2D() = default;
     BoxCollider2D(float width, float height) : size(width, height) {}
+    ~BoxCollider2D() override;
 
     // Size
     void SetSize(float w, float h) { size.x = w; size.y = h; }
@@ -26,6 +28,12 @@ public:
     void SetTrigger(bool trigger) { isTrigger = trigger; }
     bool IsTrigger() const { return isTrigger; }
 
+    // Collision layer (0-31), matched against query layer masks
+    static constexpr int MAX_LAYERS = 32;
+    void SetLayer(int l) { layer = l < 0 ? 0 : (l >= MAX_LAYERS ? MAX_LAYERS - 1 : l); }
+    int GetLayer() const { return layer; }
+    uint32_t GetLayerMask() const { return 1u << layer; }
+
     // Get world AABB
     AABB GetWorldAABB() const;
 
@@ -36,14 +44,24 @@ public:
     // Serialization
     void Serialize(nlohmann::json& j) const override;
     void Deserialize(const nlohmann::json& j) override;
+    void SerializeBinary(BinaryWriter& writer) const override;
+    void DeserializeBinary(BinaryReader& reader) override;
 
     // Editor GUI
     void OnInspectorGUI() override;
 
+    // Broadphase registration
+    void OnAttach() override;
+    void OnDetach() override;
+
 private:
+    friend class PhysicsWorld;
+    int proxyId = -1;  // Slot in PhysicsWorld, -1 when not registered
+
     Vector2 size = Vector2(32.0f, 32.0f);
     Vector2 offset = Vector2::Zero();
     bool isTrigger = false;
+    int layer = 0;
 };
 
 #endif // MOLGA_BOX_COLLIDER_2D_COMPONENT_H
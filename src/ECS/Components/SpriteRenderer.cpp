@@ -8,26 +8,95 @@
 #include "../../Texture.h"
 #include "../../Core/TextureManager.h"
 #include "../../Core/Project.h"
+#include "../../SpriteCuller.h"
 #include <nlohmann/json.hpp>
+#include <cmath>
 #include <filesystem>
 #ifdef MOLGA_EDITOR
 #include <imgui.h>
 #endif
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 using json = nlohmann::json;
 
+SpriteRenderer::~SpriteRenderer() {
+    // Normally already unregistered by OnDetach
+    SpriteCuller::Get().Unregister(this);
+}
+
+void SpriteRenderer::OnAttach() {
+    SpriteCuller::Get().Register(this);
+}
+
+void SpriteRenderer::OnDetach() {
+    SpriteCuller::Get().Unregister(this);
+}
+
+void SpriteRenderer::SetStatic(bool value) {
+    if (value == isStatic) return;
+
+    isStatic = value;
+    if (cullId >= 0) {
+        SpriteCuller::Get().Unregister(this);
+        SpriteCuller::Get().Register(this);
+    }
+}
+
+AABB SpriteRenderer::GetWorldBounds(const Transform& transform) const {
+    Vector2 position = transform.GetRenderPosition();
+    Vector2 scale = transform.GetRenderScale();
+
+    // Same quad as RenderSprite: top-left at the position, rotated about
+    // its center. Flips and negative scales keep it within these extents.
+    float w = std::fabs(width * scale.x);
+    float h = std::fabs(height * scale.y);
+    float centerX = position.x + width * scale.x * 0.5f;
+    float centerY = position.y + height * scale.y * 0.5f;
+
+    float rotation = transform.GetRenderRotation();
+    if (rotation != 0.0f) {
+        float radians = rotation * (float)M_PI / 180.0f;
+        float c = std::fabs(std::cos(radians));
+        float s = std::fabs(std::sin(radians));
+        float rotatedW = c * w + s * h;
+        float rotatedH = s * w + c * h;
+        w = rotatedW;
+        h = rotatedH;
+    }
+
+    return AABB(centerX - w * 0.5f, centerY - h * 0.5f, w, h);
+}
+
+void SpriteRenderer::SetRegion(const AtlasRegion& region) {
+    texture = region.texture;
+    uv = region.frame;
+}
+
+void SpriteRenderer::ResolveTexture() {
+    if (texturePath.empty()) return;
+
+    AtlasRegion region = TextureManager::Get().GetRegion(texturePath);
+    if (region.IsValid()) {
+        SetRegion(region);
+    }
+}
+
 void SpriteRenderer::RenderSprite(Renderer* renderer, Shader* shader, Camera2D* camera) {
     if (!gameObject || !enabled) return;
 
     Transform* transform = gameObject->GetComponent<Transform>();
     if (!transform) return;
 
-    // Create a temporary sprite for rendering
-    Sprite sprite;
+    RenderSprite(renderer, shader, camera, *transform);
+}
 
-    Vector2 worldPos = transform->GetWorldPosition();
-    Vector2 worldScale = transform->GetWorldScale();
-    float worldRot = transform->GetWorldRotation();
+void SpriteRenderer::BuildSprite(const Transform& transform, Sprite& sprite) const {
+    Vector2 worldPos = transform.GetRenderPosition();
+    Vector2 worldScale = transform.GetRenderScale();
+    float worldRot = transform.GetRenderRotation();
 
     sprite.SetPosition(worldPos.x, worldPos.y);
     sprite.SetSize(width * worldScale.x, height * worldScale.y);
@@ -36,6 +105,7 @@ void SpriteRenderer::RenderSprite(Renderer* renderer, Shader* shader, Camera2D*
 
     if (texture) {
         sprite.SetTexture(texture);
+        sprite.SetUV(uv.u0, uv.v0, uv.u1, uv.v1);
     }
 
     // Apply flip
@@ -47,6 +117,19 @@ void SpriteRenderer::RenderSprite(Renderer* renderer, Shader* shader, Camera2D*
         sprite.y += sprite.height;
         sprite.height = -sprite.height;
     }
+}
+
+void SpriteRenderer::RenderSprite(Renderer* renderer, Shader* shader, Camera2D* camera, const Transform& transform) {
+    if (!enabled) return;
+
+    Sprite sprite;
+    BuildSprite(transform, sprite);
+
+    // Draw into the caller's pass if one is open so sprites can be batched
+    if (renderer->IsDrawing()) {
+        renderer->DrawSprite(&sprite);
+        return;
+    }
 
     renderer->Begin(shader, camera);
     renderer->DrawSprite(&sprite);
@@ -58,8 +141,10 @@ void SpriteRenderer::Serialize(nlohmann::json& j) const {
     j["size"] = { width, height };
     j["flipX"] = flipX;
     j["flipY"] = flipY;
+    j["sortingLayer"] = sortingLayer;
     j["sortingOrder"] = sortingOrder;
     j["texturePath"] = texturePath;
+    j["static"] = isStatic;
 }
 
 void SpriteRenderer::Deserialize(const nlohmann::json& j) {
@@ -75,12 +160,64 @@ void SpriteRenderer::Deserialize(const nlohmann::json& j) {
     if (j.contains("flipY")) {
         SetFlipY(j["flipY"]);
     }
+    if (j.contains("sortingLayer")) {
+        SetSortingLayer(j["sortingLayer"]);
+    }
     if (j.contains("sortingOrder")) {
         SetSortingOrder(j["sortingOrder"]);
     }
     if (j.contains("texturePath")) {
         SetTexturePath(j["texturePath"]);
     }
+    if (j.contains("static")) {
+        SetStatic(j["static"]);
+    }
+}
+
+void SpriteRenderer::SerializeBinary(BinaryWriter& writer) const {
+    writer.Write(color.r);
+    writer.Write(color.g);
+    writer.Write(color.b);
+    writer.Write(color.a);
+    writer.Write(width);
+    writer.Write(height);
+    writer.Write(static_cast<uint8_t>(flipX ? 1 : 0));
+    writer.Write(static_cast<uint8_t>(flipY ? 1 : 0));
+    writer.Write(static_cast<int32_t>(sortingOrder));
+    writer.WriteString(texturePath);
+    writer.Write(static_cast<uint8_t>(isStatic ? 1 : 0));
+    writer.Write(static_cast<uint8_t>(sortingLayer));
+}
+
+void SpriteRenderer::DeserializeBinary(BinaryReader& reader) {
+    float r = reader.Read<float>();
+    float g = reader.Read<float>();
+    float b = reader.Read<float>();
+    float a = reader.Read<float>();
+    float w = reader.Read<float>();
+    float h = reader.Read<float>();
+    uint8_t fx = reader.Read<uint8_t>();
+    uint8_t fy = reader.Read<uint8_t>();
+    int32_t order = reader.Read<int32_t>();
+    std::string_view path = reader.ReadString();
+    if (!reader.IsOk()) return;
+
+    SetColor(r, g, b, a);
+    SetSize(w, h);
+    SetFlipX(fx != 0);
+    SetFlipY(fy != 0);
+    SetSortingOrder(order);
+    SetTexturePath(std::string(path));
+
+    // Added later; older scenes end before these
+    uint8_t savedStatic = reader.Read<uint8_t>();
+    if (reader.IsOk()) {
+        SetStatic(savedStatic != 0);
+    }
+    uint8_t savedLayer = reader.Read<uint8_t>();
+    if (reader.IsOk()) {
+        SetSortingLayer(savedLayer);
+    }
 }
 
 void SpriteRenderer::OnInspectorGUI() {
@@ -104,6 +241,7 @@ void SpriteRenderer::OnInspectorGUI() {
     if (ImGui::Button("Clear")) {
         texturePath.clear();
         texture = nullptr;
+        uv = Frame();
     }
 
     // Drop target for texture
@@ -121,6 +259,7 @@ void SpriteRenderer::OnInspectorGUI() {
 
             // Load the texture
             texture = TextureManager::Get().Load(droppedPath);
+            uv = Frame();
 
             // Auto-set size from texture if not set
             if (texture && (width == 32.0f && height == 32.0f)) {
@@ -140,6 +279,7 @@ void SpriteRenderer::OnInspectorGUI() {
                 absPath = Project::Get().GetAbsolutePath(texturePath);
             }
             texture = TextureManager::Get().Load(absPath);
+            uv = Frame();
         }
     }
 
@@ -152,7 +292,8 @@ void SpriteRenderer::OnInspectorGUI() {
         float previewSize = 64.0f;
         float aspect = static_cast<float>(texture->GetWidth()) / static_cast<float>(texture->GetHeight());
         ImVec2 size = aspect > 1.0f ? ImVec2(previewSize, previewSize / aspect) : ImVec2(previewSize * aspect, previewSize);
-        ImGui::Image(static_cast<ImTextureID>(texture->GetID()), size);
+        ImGui::Image(static_cast<ImTextureID>(texture->GetID()), size,
+                     ImVec2(uv.u0, uv.v0), ImVec2(uv.u1, uv.v1));
     } else if (!texturePath.empty()) {
         ImGui::TextColored(ImVec4(0.8f, 0.5f, 0.3f, 1.0f), "Not loaded");
     }
@@ -181,9 +322,19 @@ void SpriteRenderer::OnInspectorGUI() {
         SetFlipY(fy);
     }
 
+    int layer = sortingLayer;
+    if (ImGui::SliderInt("Sorting Layer", &layer, 0, 255)) {
+        SetSortingLayer(layer);
+    }
+
     int order = sortingOrder;
     if (ImGui::InputInt("Sorting Order", &order)) {
         SetSortingOrder(order);
     }
+
+    bool staticSprite = isStatic;
+    if (ImGui::Checkbox("Static", &staticSprite)) {
+        SetStatic(staticSprite);
+    }
 #endif
 }
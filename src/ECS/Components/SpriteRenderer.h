@@ -6,15 +6,19 @@
 #include <string>
 
 class Texture;
+class Sprite;
+struct AtlasRegion;
 class Renderer;
 class Shader;
 class Camera2D;
+class Transform;
 
 class SpriteRenderer : public Component {
 public:
     COMPONENT_TYPE(SpriteRenderer)
 
     SpriteRenderer() = default;
+    ~SpriteRenderer() override;
 
     // Texture
     void SetTexture(Texture* tex) { texture = tex; }
@@ -23,6 +27,16 @@ public:
     void SetTexturePath(const std::string& path) { texturePath = path; }
     const std::string& GetTexturePath() const { return texturePath; }
 
+    // UV rect inside the texture (whole texture by default)
+    void SetUV(const Frame& frame) { uv = frame; }
+    const Frame& GetUV() const { return uv; }
+
+    // Use an atlas region (sets both texture and UV rect)
+    void SetRegion(const AtlasRegion& region);
+
+    // Look up texturePath in TextureManager (atlas region if packed)
+    void ResolveTexture();
+
     // Color/Tint
     void SetColor(const Color& c) { color = c; }
     void SetColor(float r, float g, float b, float a = 1.0f) { color = Color(r, g, b, a); }
@@ -41,23 +55,49 @@ public:
     bool GetFlipX() const { return flipX; }
     bool GetFlipY() const { return flipY; }
 
-    // Sorting order (higher = rendered on top)
-    void SetSortingOrder(int order) { sortingOrder = order; }
+    // Sorting layer (0-255), then order within the layer (-32768 to
+    // 32767); higher = rendered on top
+    void SetSortingLayer(int layer) { sortingLayer = layer < 0 ? 0 : (layer > 255 ? 255 : layer); }
+    int GetSortingLayer() const { return sortingLayer; }
+    void SetSortingOrder(int order) { sortingOrder = order < -32768 ? -32768 : (order > 32767 ? 32767 : order); }
     int GetSortingOrder() const { return sortingOrder; }
 
+    // Static sprites are not expected to move. SpriteCuller keeps them in a
+    // grid index and never visits them while off screen; after moving or
+    // resizing one anyway, call SpriteCuller::Get().Refresh(sprite).
+    void SetStatic(bool value);
+    bool IsStatic() const { return isStatic; }
+
+    // World-space box around the drawn quad (bounding box when rotated)
+    AABB GetWorldBounds(const Transform& transform) const;
+
+    // The quad RenderSprite draws, at the transform's render position
+    void BuildSprite(const Transform& transform, Sprite& out) const;
+
     // Render using external renderer
     void RenderSprite(Renderer* renderer, Shader* shader, Camera2D* camera);
+    // Same, for callers that already have the owner's Transform (ECS views)
+    void RenderSprite(Renderer* renderer, Shader* shader, Camera2D* camera, const Transform& transform);
 
     // Serialization
     void Serialize(nlohmann::json& j) const override;
     void Deserialize(const nlohmann::json& j) override;
+    void SerializeBinary(BinaryWriter& writer) const override;
+    void DeserializeBinary(BinaryReader& reader) override;
 
     // Editor GUI
     void OnInspectorGUI() override;
 
+    void OnAttach() override;
+    void OnDetach() override;
+
 private:
+    friend class SpriteCuller;
+    int cullId = -1;    // Slot in SpriteCuller, -1 when not registered
+
     Texture* texture = nullptr;
     std::string texturePath;
+    Frame uv;
     Color color = Color::White();
 
     float width = 32.0f;
@@ -66,7 +106,9 @@ private:
     bool flipX = false;
     bool flipY = false;
 
+    int sortingLayer = 0;
     int sortingOrder = 0;
+    bool isStatic = false;
 };
 
 #endif // MOLGA_SPRITE_RENDERER_COMPONENT_H
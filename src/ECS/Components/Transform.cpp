@@ -1,5 +1,9 @@
 #include "Transform.h"
 #include "../GameObject.h"
+#include "../../Core/Profiler.h"
+#include "../../Core/JobSystem.h"
+#include <cmath>
+#include <vector>
 #include <nlohmann/json.hpp>
 #ifdef MOLGA_EDITOR
 #include <imgui.h>
@@ -7,59 +11,231 @@
 
 using json = nlohmann::json;
 
-Vector2 Transform::GetWorldPosition() const {
-    Vector2 worldPos = position;
+float Transform::interpolationAlpha = 1.0f;
 
+const Transform* Transform::GetParentTransform() const {
     if (gameObject && gameObject->GetParent()) {
-        Transform* parentTransform = gameObject->GetParent()->GetComponent<Transform>();
-        if (parentTransform) {
-            Vector2 parentWorldPos = parentTransform->GetWorldPosition();
-            Vector2 parentScale = parentTransform->GetWorldScale();
-            float parentRot = parentTransform->GetWorldRotation();
-
-            // Apply parent scale
-            float scaledX = position.x * parentScale.x;
-            float scaledY = position.y * parentScale.y;
-
-            // Apply parent rotation
-            float radians = parentRot * 3.14159265f / 180.0f;
-            float cosA = std::cos(radians);
-            float sinA = std::sin(radians);
-
-            worldPos.x = scaledX * cosA - scaledY * sinA + parentWorldPos.x;
-            worldPos.y = scaledX * sinA + scaledY * cosA + parentWorldPos.y;
+        return gameObject->GetParent()->GetComponent<Transform>();
+    }
+    return nullptr;
+}
+
+void Transform::MarkDirty() {
+    // A dirty transform's descendants are always dirty too, so the walk can
+    // stop here
+    if (dirty) return;
+    dirty = true;
+
+    if (!gameObject) return;
+    for (GameObject* child : gameObject->GetChildren()) {
+        Transform* childTransform = child->GetComponent<Transform>();
+        if (childTransform) {
+            childTransform->MarkDirty();
         }
     }
+}
 
-    return worldPos;
+void Transform::OnAttach() {
+    // Children that were parented before this transform existed cached
+    // their world values without it
+    hasFixedState = false;
+    dirty = false;
+    MarkDirty();
 }
 
-float Transform::GetWorldRotation() const {
-    float worldRot = rotation;
+void Transform::OnDetach() {
+    MarkDirty();
+}
 
-    if (gameObject && gameObject->GetParent()) {
-        Transform* parentTransform = gameObject->GetParent()->GetComponent<Transform>();
-        if (parentTransform) {
-            worldRot += parentTransform->GetWorldRotation();
-        }
+void Transform::UpdateWorldTransform() const {
+    // Lazy fill from the getters writes the mutable cache, and a dirty
+    // parent's too, so it is only safe where nothing else reads them
+    MOLGA_ASSERT_MAIN_THREAD("Transform::UpdateWorldTransform");
+
+    const Transform* parent = GetParentTransform();
+    if (parent && parent->dirty) {
+        parent->UpdateWorldTransform();
+    }
+    ComputeWorldTransform(parent);
+}
+
+void Transform::ComputeWorldTransform(const Transform* parent) const {
+    if (parent) {
+        // Parent scale, then parent rotation, then parent translation
+        float radians = parent->worldRotation * 3.14159265f / 180.0f;
+        float cosA = std::cos(radians);
+        float sinA = std::sin(radians);
+        float scaledX = position.x * parent->worldScale.x;
+        float scaledY = position.y * parent->worldScale.y;
+
+        worldPosition.x = scaledX * cosA - scaledY * sinA + parent->worldPosition.x;
+        worldPosition.y = scaledX * sinA + scaledY * cosA + parent->worldPosition.y;
+        worldRotation = parent->worldRotation + rotation;
+        worldScale.x = parent->worldScale.x * scale.x;
+        worldScale.y = parent->worldScale.y * scale.y;
+    } else {
+        worldPosition = position;
+        worldRotation = rotation;
+        worldScale = scale;
     }
 
-    return worldRot;
+    float radians = worldRotation * 3.14159265f / 180.0f;
+    float cosA = std::cos(radians);
+    float sinA = std::sin(radians);
+    worldMatrix[0] = cosA * worldScale.x;
+    worldMatrix[1] = sinA * worldScale.x;
+    worldMatrix[2] = -sinA * worldScale.y;
+    worldMatrix[3] = cosA * worldScale.y;
+    worldMatrix[4] = worldPosition.x;
+    worldMatrix[5] = worldPosition.y;
+
+    dirty = false;
+}
+
+Vector2 Transform::GetWorldPosition() const {
+    if (dirty) UpdateWorldTransform();
+    return worldPosition;
+}
+
+float Transform::GetWorldRotation() const {
+    if (dirty) UpdateWorldTransform();
+    return worldRotation;
 }
 
 Vector2 Transform::GetWorldScale() const {
-    Vector2 worldScale = scale;
+    if (dirty) UpdateWorldTransform();
+    return worldScale;
+}
 
-    if (gameObject && gameObject->GetParent()) {
-        Transform* parentTransform = gameObject->GetParent()->GetComponent<Transform>();
-        if (parentTransform) {
-            Vector2 parentScale = parentTransform->GetWorldScale();
-            worldScale.x *= parentScale.x;
-            worldScale.y *= parentScale.y;
+const float* Transform::GetWorldMatrix() const {
+    if (dirty) UpdateWorldTransform();
+    return worldMatrix;
+}
+
+Vector2 Transform::TransformPoint(const Vector2& local) const {
+    const float* m = GetWorldMatrix();
+    return Vector2(m[0] * local.x + m[2] * local.y + m[4],
+                   m[1] * local.x + m[3] * local.y + m[5]);
+}
+
+void Transform::UpdateSubtree(const Transform* root, std::vector<const Transform*>& stack) {
+    // A transform is popped before its children are pushed, so by the time
+    // a child is computed its parent is final. Only the subtree's own
+    // transforms are written and no getter is called, so subtrees can run
+    // on different threads.
+    stack.push_back(root);
+    while (!stack.empty()) {
+        const Transform* current = stack.back();
+        stack.pop_back();
+
+        if (current->dirty) {
+            current->ComputeWorldTransform(current->GetParentTransform());
+        }
+
+        for (GameObject* child : current->gameObject->GetChildren()) {
+            const Transform* childTransform = child->GetComponent<Transform>();
+            if (childTransform) {
+                stack.push_back(childTransform);
+            }
         }
     }
+}
 
-    return worldScale;
+void Transform::UpdateWorldTransforms() {
+    MOLGA_PROFILE("Transform::UpdateWorldTransforms");
+
+    // Depth-first from every root so parents are always resolved before
+    // their children; clean subtrees are still walked because a dirty
+    // descendant can sit below a clean ancestor
+    JobSystem& jobs = JobSystem::Get();
+    if (!jobs.IsRunning()) {
+        std::vector<const Transform*> stack;
+        EntityRegistry::Get().View<Transform>().Each([&stack](GameObject*, Transform& transform) {
+            if (!transform.GetParentTransform()) {
+                UpdateSubtree(&transform, stack);
+            }
+        });
+        return;
+    }
+
+    // Subtrees share no state, so each job takes a range of roots
+    std::vector<const Transform*> roots;
+    EntityRegistry::Get().View<Transform>().Each([&roots](GameObject*, Transform& transform) {
+        if (!transform.GetParentTransform()) {
+            roots.push_back(&transform);
+        }
+    });
+
+    jobs.ParallelFor(roots.size(), ROOTS_PER_JOB, [&roots](size_t begin, size_t end) {
+        MOLGA_PROFILE("Transform::UpdateSubtrees");
+        thread_local std::vector<const Transform*> stack;
+        for (size_t i = begin; i < end; i++) {
+            UpdateSubtree(roots[i], stack);
+        }
+    });
+}
+
+void Transform::SaveFixedStates() {
+    UpdateWorldTransforms();
+
+    EntityRegistry::Get().View<Transform>().Each([](GameObject*, Transform& transform) {
+        transform.fixedPosition = transform.worldPosition;
+        transform.fixedRotation = transform.worldRotation;
+        transform.fixedScale = transform.worldScale;
+        transform.hasFixedState = true;
+    });
+}
+
+void Transform::SaveFixedMotion() {
+    UpdateWorldTransforms();
+
+    EntityRegistry::Get().View<Transform>().Each([](GameObject*, Transform& transform) {
+        if (!transform.hasFixedState) {
+            // Created during the step: nothing to blend from
+            transform.fixedMotionPosition = Vector2();
+            transform.fixedMotionRotation = 0.0f;
+            transform.fixedMotionScale = Vector2();
+            return;
+        }
+
+        transform.fixedMotionPosition = transform.worldPosition - transform.fixedPosition;
+        transform.fixedMotionScale = transform.worldScale - transform.fixedScale;
+
+        // Along the shorter arc
+        float delta = std::fmod(transform.worldRotation - transform.fixedRotation, 360.0f);
+        if (delta > 180.0f) delta -= 360.0f;
+        if (delta < -180.0f) delta += 360.0f;
+        transform.fixedMotionRotation = delta;
+    });
+}
+
+// Drawn (1 - alpha) of the last fixed step behind the current state: at
+// alpha 0 where the step started, at alpha 1 where it ended. Whatever moved
+// the transform after the step is kept in full.
+
+Vector2 Transform::GetRenderPosition() const {
+    Vector2 current = GetWorldPosition();
+    if (interpolationAlpha >= 1.0f) return current;
+
+    float behind = 1.0f - interpolationAlpha;
+    return Vector2(current.x - fixedMotionPosition.x * behind,
+                   current.y - fixedMotionPosition.y * behind);
+}
+
+float Transform::GetRenderRotation() const {
+    float current = GetWorldRotation();
+    if (interpolationAlpha >= 1.0f) return current;
+
+    return current - fixedMotionRotation * (1.0f - interpolationAlpha);
+}
+
+Vector2 Transform::GetRenderScale() const {
+    Vector2 current = GetWorldScale();
+    if (interpolationAlpha >= 1.0f) return current;
+
+    float behind = 1.0f - interpolationAlpha;
+    return Vector2(current.x - fixedMotionScale.x * behind,
+                   current.y - fixedMotionScale.y * behind);
 }
 
 void Transform::Serialize(nlohmann::json& j) const {
@@ -80,6 +256,27 @@ void Transform::Deserialize(const nlohmann::json& j) {
     }
 }
 
+void Transform::SerializeBinary(BinaryWriter& writer) const {
+    writer.Write(position.x);
+    writer.Write(position.y);
+    writer.Write(rotation);
+    writer.Write(scale.x);
+    writer.Write(scale.y);
+}
+
+void Transform::DeserializeBinary(BinaryReader& reader) {
+    float x = reader.Read<float>();
+    float y = reader.Read<float>();
+    float rot = reader.Read<float>();
+    float sx = reader.Read<float>();
+    float sy = reader.Read<float>();
+    if (!reader.IsOk()) return;
+
+    SetPosition(x, y);
+    SetRotation(rot);
+    SetScale(sx, sy);
+}
+
 void Transform::OnInspectorGUI() {
 #ifdef MOLGA_EDITOR
     float pos[2] = { position.x, position.y };
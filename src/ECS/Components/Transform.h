@@ -3,6 +3,8 @@
 
 #include "../Component.h"
 #include "../../Common/Types.h"
+#include <cstddef>
+#include <vector>
 
 class Transform : public Component {
 public:
@@ -14,48 +16,120 @@ public:
 
     // Position
     Vector2 GetPosition() const { return position; }
-    void SetPosition(const Vector2& pos) { position = pos; }
-    void SetPosition(float x, float y) { position.x = x; position.y = y; }
+    void SetPosition(const Vector2& pos) { position = pos; MarkDirty(); }
+    void SetPosition(float x, float y) { position.x = x; position.y = y; MarkDirty(); }
 
     float GetX() const { return position.x; }
     float GetY() const { return position.y; }
-    void SetX(float x) { position.x = x; }
-    void SetY(float y) { position.y = y; }
+    void SetX(float x) { position.x = x; MarkDirty(); }
+    void SetY(float y) { position.y = y; MarkDirty(); }
 
     // Rotation (in degrees)
     float GetRotation() const { return rotation; }
-    void SetRotation(float degrees) { rotation = degrees; }
+    void SetRotation(float degrees) { rotation = degrees; MarkDirty(); }
 
     // Scale
     Vector2 GetScale() const { return scale; }
-    void SetScale(const Vector2& s) { scale = s; }
-    void SetScale(float x, float y) { scale.x = x; scale.y = y; }
-    void SetScale(float uniform) { scale.x = scale.y = uniform; }
+    void SetScale(const Vector2& s) { scale = s; MarkDirty(); }
+    void SetScale(float x, float y) { scale.x = x; scale.y = y; MarkDirty(); }
+    void SetScale(float uniform) { scale.x = scale.y = uniform; MarkDirty(); }
 
     // Movement helpers
-    void Translate(const Vector2& delta) { position += delta; }
-    void Translate(float dx, float dy) { position.x += dx; position.y += dy; }
+    void Translate(const Vector2& delta) { position += delta; MarkDirty(); }
+    void Translate(float dx, float dy) { position.x += dx; position.y += dy; MarkDirty(); }
 
-    // Get world position (considering parent transforms)
+    // World-space values (considering parent transforms). These are cached
+    // and only recomputed after this transform or an ancestor changed. A
+    // dirty transform is recomputed on the first read, which writes the
+    // cache: off the main thread only read transforms that
+    // UpdateWorldTransforms already resolved.
     Vector2 GetWorldPosition() const;
-
-    // Get world rotation
     float GetWorldRotation() const;
-
-    // Get world scale
     Vector2 GetWorldScale() const;
 
+    // World 2x3 affine matrix, column-major: { a, b, c, d, tx, ty }
+    // x' = a * x + c * y + tx,  y' = b * x + d * y + ty
+    const float* GetWorldMatrix() const;
+    Vector2 TransformPoint(const Vector2& local) const;
+
+    // Invalidate the cached world transform of this transform and all of
+    // its descendants (called by setters and when the parent changes)
+    void MarkDirty();
+    bool IsDirty() const { return dirty; }
+
+    // Recompute every dirty transform in hierarchy order (parents before
+    // children). Call once per frame before rendering. When the JobSystem
+    // is running, root subtrees are updated in parallel.
+    static void UpdateWorldTransforms();
+
+    // World values for rendering: the motion of the last fixed simulation
+    // step is blended in by the interpolation alpha, so a body stepped at a
+    // fixed rate moves smoothly. Motion from Update and LateUpdate is drawn
+    // as is. Same as the world values when the alpha is 1.
+    Vector2 GetRenderPosition() const;
+    float GetRenderRotation() const;
+    Vector2 GetRenderScale() const;
+
+    // Record every transform's world state at the start of a fixed step
+    static void SaveFixedStates();
+
+    // Record how far every transform moved since SaveFixedStates. Called at
+    // the end of each fixed step.
+    static void SaveFixedMotion();
+
+    static void SetInterpolationAlpha(float alpha) { interpolationAlpha = alpha; }
+    static float GetInterpolationAlpha() { return interpolationAlpha; }
+
+    void OnAttach() override;
+    void OnDetach() override;
+
     // Serialization
     void Serialize(nlohmann::json& j) const override;
     void Deserialize(const nlohmann::json& j) override;
+    void SerializeBinary(BinaryWriter& writer) const override;
+    void DeserializeBinary(BinaryReader& reader) override;
 
     // Editor GUI
     void OnInspectorGUI() override;
 
 private:
+    // Lazy path of the getters: resolves dirty ancestors first. Main thread only.
+    void UpdateWorldTransform() const;
+
+    // Compute this transform's world values from its parent's, which must
+    // already be up to date. Never touches any other transform.
+    void ComputeWorldTransform(const Transform* parent) const;
+    const Transform* GetParentTransform() const;
+
+    // Update root and its descendants; stack is scratch space
+    static void UpdateSubtree(const Transform* root, std::vector<const Transform*>& stack);
+
+    // Root hierarchies handed to one job
+    static constexpr size_t ROOTS_PER_JOB = 64;
+
     Vector2 position;
     float rotation = 0.0f;  // degrees
     Vector2 scale = Vector2::One();
+
+    // World transform cache
+    mutable bool dirty = true;
+    mutable Vector2 worldPosition;
+    mutable float worldRotation = 0.0f;
+    mutable Vector2 worldScale = Vector2::One();
+    mutable float worldMatrix[6] = { 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
+    // World state at the start of the last fixed step
+    bool hasFixedState = false;
+    Vector2 fixedPosition;
+    float fixedRotation = 0.0f;
+    Vector2 fixedScale = Vector2::One();
+
+    // World change made by the last fixed step
+    Vector2 fixedMotionPosition;
+    float fixedMotionRotation = 0.0f;
+    Vector2 fixedMotionScale;
+
+    static float interpolationAlpha;
 };
 
 #endif // MOLGA_TRANSFORM_COMPONENT_H
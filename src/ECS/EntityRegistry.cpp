@@ -0,0 +1,108 @@
+#include "EntityRegistry.h"
+#include "GameObject.h"
+#include "Component.h"
+#include <atomic>
+#include <iostream>
+
+ComponentTypeId NextComponentTypeId() {
+    // Atomic because the first GetComponentTypeId<T>() of two different
+    // types may run at the same time on job system workers
+    static std::atomic<ComponentTypeId> next{0};
+    ComponentTypeId id = next.fetch_add(1, std::memory_order_relaxed);
+    if (id == MAX_COMPONENT_TYPES) {
+        std::cerr << "[EntityRegistry] More than " << MAX_COMPONENT_TYPES
+                  << " component types; extra types fall back to heap storage" << std::endl;
+    }
+    return id;
+}
+
+EntityRegistry& EntityRegistry::Get() {
+    // Intentionally never destroyed: GameObjects held by other statics may
+    // still be torn down after main() returns
+    static EntityRegistry* instance = new EntityRegistry();
+    return *instance;
+}
+
+EntityRegistry::EntityRegistry() {
+    GetArchetype(ComponentMask());
+}
+
+void EntityRegistry::DestroyComponent(ComponentTypeId type, Component* component) {
+    pools[type]->Destroy(component);
+}
+
+Archetype* EntityRegistry::GetArchetype(const ComponentMask& mask) {
+    auto it = archetypeLookup.find(mask);
+    if (it != archetypeLookup.end()) {
+        return it->second;
+    }
+
+    auto archetype = std::make_unique<Archetype>();
+    archetype->mask = mask;
+    for (ComponentTypeId type = 0; type < MAX_COMPONENT_TYPES; type++) {
+        archetype->columnIndex[type] = -1;
+        if (mask.test(type)) {
+            archetype->columnIndex[type] = static_cast<int16_t>(archetype->types.size());
+            archetype->types.push_back(type);
+        }
+    }
+    archetype->columns.resize(archetype->types.size());
+
+    Archetype* result = archetype.get();
+    archetypes.push_back(std::move(archetype));
+    archetypeLookup[mask] = result;
+    return result;
+}
+
+void EntityRegistry::AddEntity(GameObject* entity) {
+    Archetype* empty = archetypes[0].get();
+    entity->archetype = empty;
+    entity->archetypeRow = empty->entities.size();
+    empty->entities.push_back(entity);
+}
+
+void EntityRegistry::RemoveEntity(GameObject* entity) {
+    Archetype* archetype = entity->archetype;
+    if (!archetype) return;
+
+    // Swap-remove the row, keeping the moved entity's row index in sync
+    size_t row = entity->archetypeRow;
+    size_t last = archetype->entities.size() - 1;
+    if (row != last) {
+        GameObject* moved = archetype->entities[last];
+        archetype->entities[row] = moved;
+        for (auto& column : archetype->columns) {
+            column[row] = column[last];
+        }
+        moved->archetypeRow = row;
+    }
+    archetype->entities.pop_back();
+    for (auto& column : archetype->columns) {
+        column.pop_back();
+    }
+
+    entity->archetype = nullptr;
+    entity->archetypeRow = 0;
+}
+
+void EntityRegistry::SetArchetypeComponent(GameObject* entity, ComponentTypeId type, Component* component) {
+    Archetype* from = entity->archetype;
+    size_t fromRow = entity->archetypeRow;
+
+    ComponentMask mask = from->mask;
+    mask.set(type, component != nullptr);
+    Archetype* to = GetArchetype(mask);
+
+    for (size_t i = 0; i < to->types.size(); i++) {
+        ComponentTypeId columnType = to->types[i];
+        Component* value = columnType == type
+            ? component
+            : from->columns[from->ColumnIndex(columnType)][fromRow];
+        to->columns[i].push_back(value);
+    }
+    to->entities.push_back(entity);
+
+    RemoveEntity(entity);
+    entity->archetype = to;
+    entity->archetypeRow = to->entities.size() - 1;
+}
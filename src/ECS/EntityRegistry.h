@@ -0,0 +1,131 @@
+#ifndef MOLGA_ENTITY_REGISTRY_H
+#define MOLGA_ENTITY_REGISTRY_H
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include "ComponentTypeId.h"
+#include "ComponentPool.h"
+
+class Component;
+class GameObject;
+
+// All GameObjects with the same set of (typed) components. Each column is
+// a dense array of component pointers parallel to `entities`, so iterating
+// an archetype is a linear walk with no lookups. Columns hold pointers into
+// the per-type ComponentPool chunks rather than the components themselves:
+// components are polymorphic and scenes, PhysicsWorld and scripts keep raw
+// pointers to them, so they must not move when an entity changes archetype.
+struct Archetype {
+    ComponentMask mask;
+    std::vector<ComponentTypeId> types;
+    std::vector<GameObject*> entities;
+    std::vector<std::vector<Component*>> columns;
+
+    // Column of the given type, or -1 if the archetype doesn't have it
+    int ColumnIndex(ComponentTypeId type) const {
+        return type < MAX_COMPONENT_TYPES ? columnIndex[type] : -1;
+    }
+
+    int16_t columnIndex[MAX_COMPONENT_TYPES];
+};
+
+// Iterates every GameObject that has all of Ts, e.g.
+//   registry.View<Transform, SpriteRenderer>().Each(
+//       [](GameObject* obj, Transform& t, SpriteRenderer& sr) { ... });
+// Components must not be added or removed from inside Each.
+template<typename... Ts>
+class ComponentView {
+public:
+    explicit ComponentView(const std::vector<std::unique_ptr<Archetype>>& archetypes)
+        : archetypes(archetypes) {
+        ComponentTypeId ids[] = { GetComponentTypeId<Ts>()... };
+        for (ComponentTypeId id : ids) {
+            if (id < MAX_COMPONENT_TYPES) mask.set(id);
+        }
+    }
+
+    template<typename Func>
+    void Each(Func&& func) const {
+        EachImpl(func, std::index_sequence_for<Ts...>{});
+    }
+
+    size_t Count() const {
+        size_t count = 0;
+        for (const auto& archetype : archetypes) {
+            if ((archetype->mask & mask) == mask) count += archetype->entities.size();
+        }
+        return count;
+    }
+
+private:
+    template<typename Func, size_t... I>
+    void EachImpl(Func& func, std::index_sequence<I...>) const {
+        for (const auto& archetype : archetypes) {
+            if ((archetype->mask & mask) != mask) continue;
+
+            Component* const* columns[] = {
+                archetype->columns[archetype->ColumnIndex(GetComponentTypeId<Ts>())].data()...
+            };
+            GameObject* const* entities = archetype->entities.data();
+            size_t count = archetype->entities.size();
+
+            for (size_t row = 0; row < count; row++) {
+                func(entities[row], *static_cast<Ts*>(columns[I][row])...);
+            }
+        }
+    }
+
+    const std::vector<std::unique_ptr<Archetype>>& archetypes;
+    ComponentMask mask;
+};
+
+// Owns component storage and the archetype tables. GameObject is the public
+// facade; most code should not need to talk to the registry directly except
+// for View iteration.
+class EntityRegistry {
+public:
+    static EntityRegistry& Get();
+
+    template<typename T, typename... Args>
+    T* CreateComponent(Args&&... args) {
+        ComponentTypeId type = GetComponentTypeId<T>();
+        auto& pool = pools[type];
+        if (!pool) {
+            pool = std::make_unique<ComponentPool<T>>();
+        }
+        return static_cast<ComponentPool<T>*>(pool.get())->Create(std::forward<Args>(args)...);
+    }
+
+    void DestroyComponent(ComponentTypeId type, Component* component);
+
+    template<typename... Ts>
+    ComponentView<Ts...> View() const {
+        return ComponentView<Ts...>(archetypes);
+    }
+
+    size_t GetArchetypeCount() const { return archetypes.size(); }
+
+private:
+    friend class GameObject;
+
+    EntityRegistry();
+    EntityRegistry(const EntityRegistry&) = delete;
+    EntityRegistry& operator=(const EntityRegistry&) = delete;
+
+    Archetype* GetArchetype(const ComponentMask& mask);
+
+    void AddEntity(GameObject* entity);
+    void RemoveEntity(GameObject* entity);
+
+    // Move the entity to the archetype with `type` added (component != null)
+    // or removed (component == null)
+    void SetArchetypeComponent(GameObject* entity, ComponentTypeId type, Component* component);
+
+    std::unique_ptr<ComponentPoolBase> pools[MAX_COMPONENT_TYPES];
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<ComponentMask, Archetype*> archetypeLookup;
+};
+
+#endif // MOLGA_ENTITY_REGISTRY_H
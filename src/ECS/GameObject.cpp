@@ -1,11 +1,13 @@
 #include "GameObject.h"
 #include "Component.h"
+#include "Components/Transform.h"
 #include <algorithm>
 
 unsigned int GameObject::nextID = 1;
 
 GameObject::GameObject(const std::string& name)
     : id(nextID++), name(name) {
+    EntityRegistry::Get().AddEntity(this);
 }
 
 GameObject::~GameObject() {
@@ -13,14 +15,32 @@ GameObject::~GameObject() {
     for (auto& comp : components) {
         comp->OnDetach();
     }
+
+    // Destroy them, leaving the archetype tables untouched until the end
+    EntityRegistry& registry = EntityRegistry::Get();
+    for (size_t i = 0; i < components.size(); i++) {
+        if (componentTypes[i] != INVALID_COMPONENT_TYPE) {
+            registry.DestroyComponent(componentTypes[i], components[i]);
+        } else {
+            delete components[i];
+        }
+    }
     components.clear();
+    componentTypes.clear();
+    registry.RemoveEntity(this);
 
     // Remove from parent
     if (parent) {
         parent->RemoveChild(this);
     }
 
-    // Clear children (but don't delete them - scene manages ownership)
+    // Orphan children (but don't delete them - scene manages ownership)
+    for (GameObject* child : children) {
+        child->parent = nullptr;
+        if (Transform* transform = child->GetComponent<Transform>()) {
+            transform->MarkDirty();
+        }
+    }
     children.clear();
 }
 
@@ -39,6 +59,10 @@ void GameObject::SetParent(GameObject* newParent) {
     if (parent) {
         parent->children.push_back(this);
     }
+
+    if (Transform* transform = GetComponent<Transform>()) {
+        transform->MarkDirty();
+    }
 }
 
 void GameObject::AddChild(GameObject* child) {
@@ -56,6 +80,10 @@ void GameObject::RemoveChild(GameObject* child) {
     if (it != children.end()) {
         (*it)->parent = nullptr;
         children.erase(it);
+
+        if (Transform* transform = child->GetComponent<Transform>()) {
+            transform->MarkDirty();
+        }
     }
 }
 
@@ -69,6 +97,26 @@ void GameObject::Update(float dt) {
     }
 }
 
+void GameObject::FixedUpdate(float fixedDt) {
+    if (!active) return;
+
+    for (auto& comp : components) {
+        if (comp->IsEnabled()) {
+            comp->FixedUpdate(fixedDt);
+        }
+    }
+}
+
+void GameObject::LateUpdate(float dt) {
+    if (!active) return;
+
+    for (auto& comp : components) {
+        if (comp->IsEnabled()) {
+            comp->LateUpdate(dt);
+        }
+    }
+}
+
 void GameObject::Render() {
     if (!active) return;
 
@@ -81,8 +129,43 @@ void GameObject::Render() {
 
 Component* GameObject::AddComponentRaw(Component* component) {
     if (!component) return nullptr;
+    AttachComponent(component, INVALID_COMPONENT_TYPE);
+    return component;
+}
+
+void GameObject::AttachComponent(Component* component, ComponentTypeId type) {
     component->SetGameObject(this);
     component->OnAttach();
-    components.push_back(std::unique_ptr<Component>(component));
-    return component;
+    components.push_back(component);
+    componentTypes.push_back(type);
+
+    // Only the first component of each type is indexed by the archetype
+    if (type != INVALID_COMPONENT_TYPE && archetype->ColumnIndex(type) < 0) {
+        EntityRegistry::Get().SetArchetypeComponent(this, type, component);
+    }
+}
+
+void GameObject::DestroyComponentAt(size_t index) {
+    Component* component = components[index];
+    ComponentTypeId type = componentTypes[index];
+    components.erase(components.begin() + index);
+    componentTypes.erase(componentTypes.begin() + index);
+
+    if (type == INVALID_COMPONENT_TYPE) {
+        delete component;
+        return;
+    }
+
+    EntityRegistry& registry = EntityRegistry::Get();
+    int column = archetype->ColumnIndex(type);
+    if (column >= 0 && archetype->columns[column][archetypeRow] == component) {
+        // Promote another component of the same type if there is one
+        auto it = std::find(componentTypes.begin(), componentTypes.end(), type);
+        if (it != componentTypes.end()) {
+            archetype->columns[column][archetypeRow] = components[it - componentTypes.begin()];
+        } else {
+            registry.SetArchetypeComponent(this, type, nullptr);
+        }
+    }
+    registry.DestroyComponent(type, component);
 }
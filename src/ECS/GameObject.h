@@ -5,7 +5,8 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
-#include <typeinfo>
+#include <type_traits>
+#include "EntityRegistry.h"
 
 class Component;
 
@@ -22,32 +23,39 @@ public:
     unsigned int GetID() const { return id; }
 
     // Component management
+    // Typed components are stored in per-type pools and indexed by archetype
+    // (see EntityRegistry); GetComponent<T> for engine component types is a
+    // type ID lookup instead of a dynamic_cast scan.
     template<typename T, typename... Args>
     T* AddComponent(Args&&... args) {
         static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
-        auto component = std::make_unique<T>(std::forward<Args>(args)...);
-        T* ptr = component.get();
-        ptr->SetGameObject(this);
-        ptr->OnAttach();
-        components.push_back(std::move(component));
+        ComponentTypeId type = GetComponentTypeId<T>();
+        if (type >= MAX_COMPONENT_TYPES) {
+            return static_cast<T*>(AddComponentRaw(new T(std::forward<Args>(args)...)));
+        }
+        T* ptr = EntityRegistry::Get().CreateComponent<T>(std::forward<Args>(args)...);
+        AttachComponent(ptr, type);
         return ptr;
     }
 
     template<typename T>
     T* GetComponent() {
-        static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
-        for (auto& comp : components) {
-            T* result = dynamic_cast<T*>(comp.get());
-            if (result) return result;
-        }
-        return nullptr;
+        return const_cast<T*>(static_cast<const GameObject*>(this)->GetComponent<T>());
     }
 
     template<typename T>
     const T* GetComponent() const {
         static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
-        for (const auto& comp : components) {
-            const T* result = dynamic_cast<const T*>(comp.get());
+        int column = archetype ? archetype->ColumnIndex(GetComponentTypeId<T>()) : -1;
+        if (column >= 0) {
+            return static_cast<const T*>(archetype->columns[column][archetypeRow]);
+        }
+
+        // Slow path: components added through AddComponentRaw, and base
+        // types such as Script that are matched by inheritance
+        for (size_t i = 0; i < components.size(); i++) {
+            if (IsExactComponent<T>::value && componentTypes[i] != INVALID_COMPONENT_TYPE) continue;
+            const T* result = dynamic_cast<const T*>(components[i]);
             if (result) return result;
         }
         return nullptr;
@@ -61,23 +69,23 @@ public:
     template<typename T>
     void RemoveComponent() {
         static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
-        auto it = std::remove_if(components.begin(), components.end(),
-            [](const std::unique_ptr<Component>& comp) {
-                T* result = dynamic_cast<T*>(comp.get());
-                if (result) {
-                    result->OnDetach();
-                    return true;
-                }
-                return false;
-            });
-        components.erase(it, components.end());
+        size_t i = 0;
+        while (i < components.size()) {
+            T* match = dynamic_cast<T*>(components[i]);
+            if (match) {
+                match->OnDetach();
+                DestroyComponentAt(i);
+            } else {
+                i++;
+            }
+        }
     }
 
     // Add component from raw pointer (takes ownership)
     Component* AddComponentRaw(Component* component);
 
-    // Get all components
-    const std::vector<std::unique_ptr<Component>>& GetComponents() const { return components; }
+    // Get all components (in the order they were added)
+    const std::vector<Component*>& GetComponents() const { return components; }
 
     // Hierarchy
     GameObject* GetParent() const { return parent; }
@@ -93,18 +101,34 @@ public:
 
     // Update all components
     void Update(float dt);
+    void FixedUpdate(float fixedDt);
+    void LateUpdate(float dt);
 
     // Render all components
     void Render();
 
 private:
+    friend class EntityRegistry;
+
+    GameObject(const GameObject&) = delete;
+    GameObject& operator=(const GameObject&) = delete;
+
+    void AttachComponent(Component* component, ComponentTypeId type);
+    void DestroyComponentAt(size_t index);
+
     static unsigned int nextID;
 
     unsigned int id;
     std::string name;
     bool active = true;
 
-    std::vector<std::unique_ptr<Component>> components;
+    // Owned components in insertion order. componentTypes[i] is the pool the
+    // component lives in, or INVALID_COMPONENT_TYPE if it was heap-allocated
+    std::vector<Component*> components;
+    std::vector<ComponentTypeId> componentTypes;
+
+    Archetype* archetype = nullptr;
+    size_t archetypeRow = 0;
 
     GameObject* parent = nullptr;
     std::vector<GameObject*> children;
@@ -3,16 +3,23 @@
 #include "Windows/HierarchyWindow.h"
 #include "Windows/InspectorWindow.h"
 #include "Windows/ProjectBrowserWindow.h"
+#include "Windows/ProfilerWindow.h"
 #include "../ECS/GameObject.h"
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/SpriteRenderer.h"
 #include "../Core/SceneSerializer.h"
 #include "../Core/GameBuilder.h"
 #include "../Core/Project.h"
+#include "../Core/AssetWatcher.h"
+#include "../Common/PathUtil.h"
+#include "../Core/TextureManager.h"
+#include "../Shader.h"
 #include "../Time.h"
 #include <imgui.h>
 #include <iostream>
 #include <cstring>
+#include <algorithm>
+#include <filesystem>
 
 Editor& Editor::Get() {
     static Editor instance;
@@ -23,6 +30,7 @@ void Editor::Init() {
     hierarchyWindow = std::make_unique<HierarchyWindow>();
     inspectorWindow = std::make_unique<InspectorWindow>();
     projectBrowserWindow = std::make_unique<ProjectBrowserWindow>();
+    profilerWindow = std::make_unique<ProfilerWindow>();
 
     // Connect hierarchy selection to inspector
     hierarchyWindow->SetSelectionCallback([](GameObject* obj) {
@@ -31,13 +39,86 @@ void Editor::Init() {
 }
 
 void Editor::Shutdown() {
+    AssetWatcher::Get().Stop();
     hierarchyWindow.reset();
     inspectorWindow.reset();
     projectBrowserWindow.reset();
+    profilerWindow.reset();
 }
 
 void Editor::Update(float dt) {
-    // Editor-specific updates can go here
+    ProcessAssetChanges();
+}
+
+void Editor::ProcessAssetChanges() {
+    AssetWatcher& watcher = AssetWatcher::Get();
+
+    if (Project::Get().IsOpen() && watchedAssetsPath != Project::Get().GetAssetsPath()) {
+        watchedAssetsPath = Project::Get().GetAssetsPath();
+        watcher.Watch(watchedAssetsPath);
+    }
+    if (!watcher.IsRunning()) return;
+
+    std::vector<AssetChange> changes = watcher.Poll();
+    if (changes.empty()) return;
+
+    std::string scenePath = currentScenePath.empty() ? std::string() : PathUtil::Normalize(currentScenePath);
+    bool sceneChanged = false;
+
+    // Each change touches only what was loaded from that file
+    for (const AssetChange& change : changes) {
+        if (change.isDirectory || change.type == AssetChangeType::Removed) continue;
+
+        std::string extension = std::filesystem::path(change.path).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+        if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" ||
+            extension == ".bmp" || extension == ".tga") {
+            TextureManager::Get().Reload(change.path);
+        } else if (extension == ".vert" || extension == ".frag") {
+            Shader::ReloadFile(change.path);
+        } else if (change.path == scenePath) {
+            sceneChanged = true;
+        }
+    }
+
+    if (sceneChanged) {
+        PatchScene();
+    }
+    if (projectBrowserWindow) {
+        projectBrowserWindow->OnAssetsChanged(changes);
+    }
+}
+
+void Editor::WatchScene() {
+    // Scenes outside the project are watched on their own (not recursively)
+    std::filesystem::path directory = std::filesystem::path(PathUtil::Normalize(currentScenePath)).parent_path();
+    if (!AssetWatcher::Get().IsWatching(directory.string())) {
+        AssetWatcher::Get().Watch(directory.string(), false);
+    }
+}
+
+void Editor::PatchScene() {
+    if (!gameObjects || currentScenePath.empty()) return;
+
+    ScenePatch patch;
+    if (!SceneSerializer::PatchScene(currentScenePath, *gameObjects, sceneFingerprint, &patch)) return;
+
+    for (GameObject* obj : patch.created) {
+        if (SpriteRenderer* sprite = obj->GetComponent<SpriteRenderer>()) {
+            sprite->ResolveTexture();
+        }
+    }
+
+    // The selected object may have been rebuilt or removed
+    GameObject* selected = GetSelectedObject();
+    if (selected) {
+        bool alive = std::any_of(gameObjects->begin(), gameObjects->end(),
+            [selected](const std::shared_ptr<GameObject>& obj) { return obj.get() == selected; });
+        if (!alive) {
+            SetSelectedObject(nullptr);
+        }
+    }
 }
 
 void Editor::RenderGUI() {
@@ -57,6 +138,13 @@ void Editor::RenderGUI() {
         projectBrowserWindow->OnGUI();
     }
 
+    // Profiler
+    if (showProfiler && profilerWindow) {
+        profilerWindow->SetOpen(true);
+        profilerWindow->OnGUI();
+        showProfiler = profilerWindow->IsOpen();
+    }
+
     // Stats window
     if (showStats) {
         ImGui::SetNextWindowPos(ImVec2(10, 50), ImGuiCond_FirstUseEver);
@@ -123,6 +211,7 @@ void Editor::RenderMenuBar() {
             ImGui::MenuItem("Inspector", nullptr, &showInspector);
             ImGui::MenuItem("Project", nullptr, &showProjectBrowser);
             ImGui::MenuItem("Stats", nullptr, &showStats);
+            ImGui::MenuItem("Profiler", nullptr, &showProfiler);
             ImGui::EndMenu();
         }
 
@@ -220,6 +309,7 @@ void Editor::NewScene() {
 
     gameObjects->clear();
     currentScenePath.clear();
+    sceneFingerprint.clear();
     sceneModified = false;
 
     if (hierarchyWindow) {
@@ -240,7 +330,7 @@ void Editor::SaveScene() {
         return;
     }
 
-    if (SceneSerializer::SaveScene(currentScenePath, *gameObjects)) {
+    if (SceneSerializer::SaveScene(currentScenePath, *gameObjects, &sceneFingerprint)) {
         sceneModified = false;
     }
 }
@@ -256,9 +346,10 @@ void Editor::SaveSceneAs() {
 
     // For now, use a default path
     currentScenePath = "scene.json";
-    if (SceneSerializer::SaveScene(currentScenePath, *gameObjects)) {
+    if (SceneSerializer::SaveScene(currentScenePath, *gameObjects, &sceneFingerprint)) {
         sceneModified = false;
         std::cout << "[Editor] Scene saved to: " << currentScenePath << std::endl;
+        WatchScene();
     }
 }
 
@@ -268,9 +359,17 @@ void Editor::OpenScene() {
     // For now, use a default path
     std::string filepath = "scene.json";
 
-    if (SceneSerializer::LoadScene(filepath, *gameObjects)) {
+    if (SceneSerializer::LoadScene(filepath, *gameObjects, &sceneFingerprint)) {
         currentScenePath = filepath;
         sceneModified = false;
+        WatchScene();
+
+        // Textures load in the background; sprites show a placeholder meanwhile
+        for (auto& obj : *gameObjects) {
+            if (SpriteRenderer* sprite = obj->GetComponent<SpriteRenderer>()) {
+                sprite->ResolveTexture();
+            }
+        }
 
         if (hierarchyWindow) {
             hierarchyWindow->SetSelectedObject(nullptr);
@@ -297,6 +396,12 @@ void Editor::RenderBuildWindow() {
         ImGui::InputInt("Height", &buildHeight);
         ImGui::Checkbox("Fullscreen", &buildFullscreen);
 
+        ImGui::Separator();
+        ImGui::Text("Simulation");
+        ImGui::InputInt("Fixed Update Rate (Hz)", &buildFixedUpdateRate);
+        ImGui::InputInt("Max Sub Steps", &buildMaxSubSteps);
+        ImGui::Checkbox("Interpolate Transforms", &buildInterpolate);
+
         ImGui::Separator();
 
         // Show current scene info
@@ -342,7 +447,7 @@ void Editor::BuildGame() {
     }
 
     if (gameObjects) {
-        SceneSerializer::SaveScene(currentScenePath, *gameObjects);
+        SceneSerializer::SaveScene(currentScenePath, *gameObjects, &sceneFingerprint);
     }
 
     // Setup build settings
@@ -353,6 +458,9 @@ void Editor::BuildGame() {
     settings.windowWidth = buildWidth;
     settings.windowHeight = buildHeight;
     settings.fullscreen = buildFullscreen;
+    settings.fixedUpdateRate = buildFixedUpdateRate;
+    settings.maxSubSteps = buildMaxSubSteps;
+    settings.interpolate = buildInterpolate;
 
     isBuilding = true;
 
@@ -2,12 +2,15 @@
 #define MOLGA_EDITOR_H
 
 #include <memory>
+#include <string>
 #include <vector>
+#include "../Core/SceneSerializer.h"
 
 class GameObject;
 class HierarchyWindow;
 class InspectorWindow;
 class ProjectBrowserWindow;
+class ProfilerWindow;
 class Renderer;
 class Shader;
 class Camera2D;
@@ -52,9 +55,15 @@ private:
     void RenderBuildWindow();
     void BuildGame();
 
+    // Hot reload: apply files changed on disk (AssetWatcher)
+    void ProcessAssetChanges();
+    void WatchScene();
+    void PatchScene();
+
     std::unique_ptr<HierarchyWindow> hierarchyWindow;
     std::unique_ptr<InspectorWindow> inspectorWindow;
     std::unique_ptr<ProjectBrowserWindow> projectBrowserWindow;
+    std::unique_ptr<ProfilerWindow> profilerWindow;
 
     std::vector<std::shared_ptr<GameObject>>* gameObjects = nullptr;
 
@@ -63,16 +72,24 @@ private:
     bool showInspector = true;
     bool showProjectBrowser = true;
     bool showBuildWindow = false;
+    bool showProfiler = false;
 
     std::string currentScenePath;
     bool sceneModified = false;
 
+    // Records of the current scene file as last loaded or saved
+    SceneFingerprint sceneFingerprint;
+    std::string watchedAssetsPath;
+
     // Build settings
     char buildGameName[128] = "MyGame";
     char buildOutputPath[256] = "build/export";
     int buildWidth = 800;
     int buildHeight = 600;
     bool buildFullscreen = false;
+    int buildFixedUpdateRate = 60;
+    int buildMaxSubSteps = 5;
+    bool buildInterpolate = true;
     bool isBuilding = false;
 };
 
@@ -1,4 +1,5 @@
 #include "ImGuiLayer.h"
+#include "../Core/Profiler.h"
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <imgui.h>
@@ -41,6 +42,9 @@ void ImGuiLayer::BeginFrame() {
 }
 
 void ImGuiLayer::EndFrame() {
+    MOLGA_PROFILE("ImGui");
+    MOLGA_PROFILE_GPU("ImGui");
+
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 }
@@ -42,7 +42,7 @@ void InspectorWindow::OnGUI() {
 
     // Draw all components using their OnInspectorGUI
     for (const auto& comp : target->GetComponents()) {
-        DrawComponent(comp.get());
+        DrawComponent(comp);
     }
 
     ImGui::Separator();
@@ -0,0 +1,257 @@
+#include "ProfilerWindow.h"
+#include "../../Core/Profiler.h"
+#include <imgui.h>
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Stable color per zone name
+ImU32 ZoneColor(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (const char* c = name; *c; c++) {
+        hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+    }
+    float hue = (hash % 360) / 360.0f;
+    float r, g, b;
+    ImGui::ColorConvertHSVtoRGB(hue, 0.5f, 0.8f, r, g, b);
+    return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+}
+
+} // namespace
+
+ProfilerWindow::ProfilerWindow()
+    : EditorWindow("Profiler") {
+}
+
+const ProfileFrame* ProfilerWindow::GetSelectedFrame() const {
+    const auto& history = Profiler::Get().GetHistory();
+    if (history.empty()) return nullptr;
+
+    if (!paused || selectedFrame < history.front().index) {
+        return &history.back();
+    }
+    size_t offset = static_cast<size_t>(selectedFrame - history.front().index);
+    return offset < history.size() ? &history[offset] : &history.back();
+}
+
+void ProfilerWindow::OnGUI() {
+    if (!isOpen) return;
+
+    ImGui::SetNextWindowSize(ImVec2(700, 450), ImGuiCond_FirstUseEver);
+    ImGui::Begin(title.c_str(), &isOpen);
+
+    bool recording = Profiler::IsEnabled();
+    if (ImGui::Checkbox("Record", &recording)) {
+        Profiler::Get().SetEnabled(recording);
+    }
+    ImGui::SameLine();
+    if (ImGui::Checkbox("Pause", &paused) && paused) {
+        const auto& history = Profiler::Get().GetHistory();
+        if (!history.empty()) selectedFrame = history.back().index;
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("Dropped zones: %llu", static_cast<unsigned long long>(Profiler::Get().GetDroppedZones()));
+
+    DrawFrameHistory();
+
+    const ProfileFrame* frame = GetSelectedFrame();
+    if (!frame) {
+        ImGui::TextDisabled("No frames recorded. Enable Record to start profiling.");
+        ImGui::End();
+        return;
+    }
+
+    ImGui::Text("Frame %llu: %.3f ms", static_cast<unsigned long long>(frame->index), frame->GetMilliseconds());
+    ImGui::Separator();
+
+    DrawFlameGraph(*frame);
+
+    if (ImGui::CollapsingHeader("CPU Zones", ImGuiTreeNodeFlags_DefaultOpen)) {
+        DrawZoneTable(*frame);
+    }
+    if (ImGui::CollapsingHeader("GPU Passes", ImGuiTreeNodeFlags_DefaultOpen)) {
+        DrawGpuZones(*frame);
+    }
+
+    ImGui::End();
+}
+
+void ProfilerWindow::DrawFrameHistory() {
+    const auto& history = Profiler::Get().GetHistory();
+
+    ImVec2 size(ImGui::GetContentRegionAvail().x, 60.0f);
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##history", size);
+    bool hovered = ImGui::IsItemHovered();
+    bool clicked = ImGui::IsItemClicked();
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + size.x, origin.y + size.y), ImGui::GetColorU32(ImGuiCol_FrameBg));
+    if (history.empty()) return;
+
+    // Scale to the slowest frame, but never below 33 ms so 60 fps frames
+    // don't fill the graph
+    double maxMs = 33.3;
+    for (const auto& frame : history) {
+        maxMs = std::max(maxMs, frame.GetMilliseconds());
+    }
+
+    float barWidth = size.x / static_cast<float>(Profiler::HISTORY_SIZE);
+    const ProfileFrame* selected = GetSelectedFrame();
+
+    for (size_t i = 0; i < history.size(); i++) {
+        const ProfileFrame& frame = history[i];
+        float height = static_cast<float>(frame.GetMilliseconds() / maxMs) * size.y;
+        float x = origin.x + i * barWidth;
+
+        ImU32 color;
+        if (&frame == selected) {
+            color = IM_COL32(255, 255, 255, 255);
+        } else if (frame.GetMilliseconds() > 33.3) {
+            color = IM_COL32(220, 80, 60, 255);
+        } else if (frame.GetMilliseconds() > 16.7) {
+            color = IM_COL32(220, 180, 60, 255);
+        } else {
+            color = IM_COL32(90, 180, 90, 255);
+        }
+        drawList->AddRectFilled(ImVec2(x, origin.y + size.y - height),
+                                ImVec2(x + std::max(barWidth - 1.0f, 1.0f), origin.y + size.y), color);
+    }
+
+    // 16.7 ms line
+    float targetY = origin.y + size.y - static_cast<float>(16.7 / maxMs) * size.y;
+    drawList->AddLine(ImVec2(origin.x, targetY), ImVec2(origin.x + size.x, targetY), IM_COL32(255, 255, 255, 60));
+
+    if (hovered) {
+        size_t index = static_cast<size_t>((ImGui::GetIO().MousePos.x - origin.x) / barWidth);
+        if (index < history.size()) {
+            ImGui::SetTooltip("Frame %llu: %.3f ms", static_cast<unsigned long long>(history[index].index),
+                              history[index].GetMilliseconds());
+            if (clicked) {
+                paused = true;
+                selectedFrame = history[index].index;
+            }
+        }
+    }
+}
+
+void ProfilerWindow::DrawFlameGraph(const ProfileFrame& frame) {
+    const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const double frameNs = static_cast<double>(std::max<uint64_t>(frame.endNs - frame.startNs, 1));
+
+    // Zones that belong to each thread
+    uint32_t threadCount = Profiler::Get().GetThreadCount();
+    std::vector<uint32_t> maxDepth(threadCount, 0);
+    std::vector<bool> hasZones(threadCount, false);
+    for (const auto& zone : frame.zones) {
+        if (zone.threadIndex >= threadCount) continue;
+        hasZones[zone.threadIndex] = true;
+        maxDepth[zone.threadIndex] = std::max(maxDepth[zone.threadIndex], zone.depth);
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    float width = ImGui::GetContentRegionAvail().x;
+
+    for (uint32_t thread = 0; thread < threadCount; thread++) {
+        if (!hasZones[thread]) continue;
+
+        ImGui::TextDisabled("%s", Profiler::Get().GetThreadName(thread).c_str());
+
+        ImVec2 origin = ImGui::GetCursorScreenPos();
+        float height = (maxDepth[thread] + 1) * rowHeight;
+        ImGui::PushID(static_cast<int>(thread));
+        ImGui::InvisibleButton("##flame", ImVec2(width, height));
+        bool hovered = ImGui::IsItemHovered();
+        ImGui::PopID();
+
+        ImVec2 mouse = ImGui::GetIO().MousePos;
+        for (const auto& zone : frame.zones) {
+            if (zone.threadIndex != thread) continue;
+
+            // Zones from other threads may straddle the frame boundary
+            double start = std::max(static_cast<double>(zone.startNs), static_cast<double>(frame.startNs));
+            double end = std::min(static_cast<double>(zone.endNs), static_cast<double>(frame.endNs));
+            if (end <= start) continue;
+
+            float x0 = origin.x + static_cast<float>((start - frame.startNs) / frameNs) * width;
+            float x1 = origin.x + static_cast<float>((end - frame.startNs) / frameNs) * width;
+            float y0 = origin.y + zone.depth * rowHeight;
+            float y1 = y0 + rowHeight - 1.0f;
+            x1 = std::max(x1, x0 + 1.0f);
+
+            drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), ZoneColor(zone.name));
+
+            // Label when it fits
+            ImVec2 textSize = ImGui::CalcTextSize(zone.name);
+            if (textSize.x + 4.0f < x1 - x0) {
+                drawList->AddText(ImVec2(x0 + 2.0f, y0 + 2.0f), IM_COL32(0, 0, 0, 255), zone.name);
+            }
+
+            if (hovered && mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1) {
+                ImGui::SetTooltip("%s\n%.3f ms", zone.name, (zone.endNs - zone.startNs) / 1000000.0);
+            }
+        }
+    }
+}
+
+void ProfilerWindow::DrawZoneTable(const ProfileFrame& frame) {
+    struct ZoneTotal {
+        const char* name;
+        double milliseconds;
+        int calls;
+    };
+
+    // Zone names are literals, but identical literals in different
+    // translation units may have different addresses, so key by content
+    std::unordered_map<std::string, size_t> indices;
+    std::vector<ZoneTotal> totals;
+    for (const auto& zone : frame.zones) {
+        auto it = indices.find(zone.name);
+        if (it == indices.end()) {
+            it = indices.emplace(zone.name, totals.size()).first;
+            totals.push_back({ zone.name, 0.0, 0 });
+        }
+        totals[it->second].milliseconds += (zone.endNs - zone.startNs) / 1000000.0;
+        totals[it->second].calls++;
+    }
+
+    std::sort(totals.begin(), totals.end(), [](const ZoneTotal& a, const ZoneTotal& b) {
+        return a.milliseconds > b.milliseconds;
+    });
+
+    if (ImGui::BeginTable("##zones", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("Total (ms)");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableHeadersRow();
+
+        for (const auto& total : totals) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(total.name);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", total.milliseconds);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", total.calls);
+        }
+        ImGui::EndTable();
+    }
+}
+
+void ProfilerWindow::DrawGpuZones(const ProfileFrame& frame) {
+    if (frame.gpuZones.empty()) {
+        ImGui::TextDisabled("No GPU timings for this frame (results arrive a few frames late)");
+        return;
+    }
+
+    double total = 0.0;
+    for (const auto& zone : frame.gpuZones) {
+        ImGui::Text("%-12s %8.3f ms", zone.name, zone.milliseconds);
+        total += zone.milliseconds;
+    }
+    ImGui::Separator();
+    ImGui::Text("%-12s %8.3f ms", "Total", total);
+}
@@ -0,0 +1,29 @@
+#ifndef MOLGA_PROFILER_WINDOW_H
+#define MOLGA_PROFILER_WINDOW_H
+
+#include "EditorWindow.h"
+#include <cstdint>
+
+struct ProfileFrame;
+
+// Shows the Profiler's frame history, a flame graph of the selected frame
+// and per-zone totals for CPU and GPU
+class ProfilerWindow : public EditorWindow {
+public:
+    ProfilerWindow();
+
+    void OnGUI() override;
+
+private:
+    void DrawFrameHistory();
+    void DrawFlameGraph(const ProfileFrame& frame);
+    void DrawZoneTable(const ProfileFrame& frame);
+    void DrawGpuZones(const ProfileFrame& frame);
+
+    const ProfileFrame* GetSelectedFrame() const;
+
+    bool paused = false;
+    uint64_t selectedFrame = 0;    // Frame index; follows the latest frame unless paused
+};
+
+#endif // MOLGA_PROFILER_WINDOW_H
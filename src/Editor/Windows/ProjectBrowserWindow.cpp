@@ -1,5 +1,7 @@
 #include "ProjectBrowserWindow.h"
 #include "../../Core/Project.h"
+#include "../../Core/AssetWatcher.h"
+#include "../../Common/PathUtil.h"
 #include <imgui.h>
 #include <filesystem>
 #include <algorithm>
@@ -324,6 +326,67 @@ void ProjectBrowserWindow::Refresh() {
     BuildFolderTree(rootFolder);
 }
 
+void ProjectBrowserWindow::OnAssetsChanged(const std::vector<AssetChange>& changes) {
+    if (currentPath.empty()) return;
+
+    std::string listed = PathUtil::Normalize(currentPath);
+    bool rescan = false;
+    bool listedRemoved = false;
+    std::vector<std::pair<std::string, FolderNode*>> rebuild;
+
+    for (const AssetChange& change : changes) {
+        std::string parent = fs::path(change.path).parent_path().string();
+        if (parent == listed) {
+            rescan = true;
+        }
+        if (!change.isDirectory || change.type == AssetChangeType::Modified) continue;
+
+        if (change.type == AssetChangeType::Removed &&
+            (change.path == listed || listed.compare(0, change.path.size() + 1, change.path + "/") == 0)) {
+            listedRemoved = true;
+        }
+        if (FolderNode* node = FindFolderNode(rootFolder, parent)) {
+            rebuild.emplace_back(parent, node);
+        }
+    }
+
+    // Top down: rebuilding a node replaces its children, so nodes below one
+    // already rebuilt are skipped (their pointers are stale by then)
+    std::sort(rebuild.begin(), rebuild.end());
+    std::vector<std::string> rebuilt;
+    for (const auto& entry : rebuild) {
+        bool covered = false;
+        for (const std::string& done : rebuilt) {
+            if (entry.first == done || entry.first.compare(0, done.size() + 1, done + "/") == 0) {
+                covered = true;
+                break;
+            }
+        }
+        if (covered) continue;
+
+        BuildFolderTree(*entry.second);
+        rebuilt.push_back(entry.first);
+    }
+
+    if (listedRemoved) {
+        NavigateTo(Project::Get().GetAssetsPath());
+    } else if (rescan) {
+        ScanDirectory(currentPath);
+    }
+}
+
+ProjectBrowserWindow::FolderNode* ProjectBrowserWindow::FindFolderNode(FolderNode& node, const std::string& path) {
+    std::string nodePath = PathUtil::Normalize(node.path);
+    if (nodePath == path) return &node;
+
+    // Only descend towards the path
+    if (path.compare(0, nodePath.size() + 1, nodePath + "/") != 0) return nullptr;
+    for (auto& child : node.children) {
+        if (FolderNode* found = FindFolderNode(child, path)) return found;
+    }
+    return nullptr;
+}
+
 void ProjectBrowserWindow::NavigateTo(const std::string& path) {
     if (fs::exists(path) && fs::is_directory(path)) {
         currentPath = fs::canonical(path).string();
@@ -6,6 +6,8 @@
 #include <vector>
 #include <functional>
 
+struct AssetChange;
+
 struct FileEntry {
     std::string name;
     std::string path;
@@ -29,6 +31,11 @@ public:
     // Refresh current directory
     void Refresh();
 
+    // Files changed on disk (from the AssetWatcher): rescan the listed
+    // directory only if something in it changed, and rebuild only the
+    // folder tree nodes that gained or lost a subdirectory
+    void OnAssetsChanged(const std::vector<AssetChange>& changes);
+
     // Navigate to path
     void NavigateTo(const std::string& path);
 
@@ -60,6 +67,7 @@ private:
     FolderNode rootFolder;
     void BuildFolderTree(FolderNode& node);
     void DrawFolderNode(FolderNode& node);
+    FolderNode* FindFolderNode(FolderNode& node, const std::string& path);
 
     // Callbacks
     FileCallback onFileSelected;
@@ -0,0 +1,460 @@
+#include "Font.h"
+#include "Texture.h"
+#include "Common/Utf8.h"
+#include "Core/BinaryStream.h"
+#include "Core/Profiler.h"
+#include "Platform/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// Private copies of the stb implementations (ImGui and TextureAtlas build
+// their own); the parts we don't call would warn as unused
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#define STBRP_STATIC
+#include "../external/imgui/imstb_rectpack.h"
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#include "../external/imgui/imstb_truetype.h"
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x544E4F46;    // "FONT"
+constexpr uint32_t CACHE_VERSION = 1;
+
+// Distance value on the glyph outline; sdf_text.frag thresholds at 0.5
+constexpr unsigned char ON_EDGE_VALUE = 128;
+
+// Empty pixels between packed glyphs so bilinear filtering never reads a
+// neighbour
+constexpr int GLYPH_GUTTER = 1;
+
+constexpr int MIN_ATLAS_SIZE = 256;
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceHash;        // Of the TTF bytes
+    uint64_t settingsHash;
+    float bakeSize;
+    float ascent;
+    float descent;
+    float lineGap;
+    int32_t atlasWidth;
+    int32_t atlasHeight;
+    uint32_t glyphCount;
+    uint32_t kerningCount;
+};
+
+struct KerningRecord {
+    uint32_t left;
+    uint32_t right;
+    float advance;
+};
+
+// FNV-1a
+uint64_t Hash(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t HashSettings(const FontImportSettings& settings) {
+    uint64_t hash = Hash(&CACHE_VERSION, sizeof(CACHE_VERSION));
+    hash = Hash(&settings.bakeSize, sizeof(settings.bakeSize), hash);
+    hash = Hash(&settings.padding, sizeof(settings.padding), hash);
+    hash = Hash(&settings.maxAtlasSize, sizeof(settings.maxAtlasSize), hash);
+    for (const auto& range : settings.ranges) {
+        hash = Hash(&range.first, sizeof(range.first), hash);
+        hash = Hash(&range.second, sizeof(range.second), hash);
+    }
+    return hash;
+}
+
+uint64_t KerningKey(uint32_t left, uint32_t right) {
+    return (static_cast<uint64_t>(left) << 32) | right;
+}
+
+} // namespace
+
+Font::Font() {
+    std::fill(std::begin(latin), std::end(latin), -1);
+}
+
+Font::~Font() = default;
+
+bool Font::Load(const std::string& path, const FontImportSettings& settings) {
+    MOLGA_PROFILE("Font::Load");
+    Unload();
+
+    // The TTF is only read to validate the cache; a shipped build may carry
+    // the cache alone
+    Platform::MappedFile source;
+    bool haveSource = source.Open(path);
+    uint64_t sourceHash = haveSource ? Hash(source.GetData(), source.GetSize()) : 0;
+    uint64_t settingsHash = HashSettings(settings);
+    std::string cachePath = GetCachePath(path);
+
+    if (ReadCache(cachePath, sourceHash, haveSource, settingsHash)) {
+        std::cout << "[Font] Loaded " << glyphs.size() << " glyphs from cache: " << cachePath << std::endl;
+    } else if (!haveSource) {
+        std::cerr << "[Font] Failed to open font: " << path << std::endl;
+        return false;
+    } else {
+        if (!Bake(static_cast<const unsigned char*>(source.GetData()), settings)) {
+            std::cerr << "[Font] Failed to bake font: " << path << std::endl;
+            Unload();
+            return false;
+        }
+        std::cout << "[Font] Baked " << glyphs.size() << " glyphs into a " << atlasWidth << "x"
+                  << atlasHeight << " atlas: " << path << std::endl;
+
+        // Not fatal: the font works, it is just baked again next time
+        WriteCache(cachePath, sourceHash, settingsHash);
+    }
+
+    BuildLookup();
+    texture = std::make_unique<Texture>(atlasWidth, atlasHeight, atlas.data(), 1);
+
+    // The GPU copy is all that is needed from here on
+    atlas.clear();
+    atlas.shrink_to_fit();
+    return true;
+}
+
+void Font::Unload() {
+    glyphs.clear();
+    std::fill(std::begin(latin), std::end(latin), -1);
+    otherGlyphs.clear();
+    kerning.clear();
+    atlas.clear();
+    texture.reset();
+    atlasWidth = 0;
+    atlasHeight = 0;
+}
+
+bool Font::Bake(const unsigned char* ttf, const FontImportSettings& settings) {
+    MOLGA_PROFILE("Font::Bake");
+
+    stbtt_fontinfo info;
+    int offset = stbtt_GetFontOffsetForIndex(ttf, 0);
+    if (offset < 0 || !stbtt_InitFont(&info, ttf, offset)) {
+        std::cerr << "[Font] Not a TrueType font" << std::endl;
+        return false;
+    }
+
+    bakeSize = settings.bakeSize;
+    float scale = stbtt_ScaleForPixelHeight(&info, bakeSize);
+    int fontAscent, fontDescent, fontLineGap;
+    stbtt_GetFontVMetrics(&info, &fontAscent, &fontDescent, &fontLineGap);
+    ascent = fontAscent * scale;
+    descent = fontDescent * scale;
+    lineGap = fontLineGap * scale;
+
+    std::vector<std::pair<uint32_t, uint32_t>> ranges = settings.ranges;
+    if (ranges.empty()) {
+        ranges = { { 0x20, 0x7E }, { 0xA0, 0xFF } };
+    }
+
+    // Rasterize every glyph the font has. The distance reaches 0 at
+    // padding pixels outside the outline.
+    struct Bitmap {
+        unsigned char* pixels;
+        int glyphIndex;
+        int width, height;
+    };
+    std::vector<Bitmap> bitmaps;
+    float distanceScale = static_cast<float>(ON_EDGE_VALUE) / settings.padding;
+
+    for (const auto& range : ranges) {
+        for (uint32_t codepoint = range.first; codepoint <= range.second; codepoint++) {
+            int glyphIndex = stbtt_FindGlyphIndex(&info, static_cast<int>(codepoint));
+            if (glyphIndex == 0) continue;
+
+            int advance, leftBearing;
+            stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &leftBearing);
+
+            int width = 0, height = 0, xOffset = 0, yOffset = 0;
+            unsigned char* pixels = stbtt_GetGlyphSDF(&info, scale, glyphIndex, settings.padding, ON_EDGE_VALUE,
+                                                      distanceScale, &width, &height, &xOffset, &yOffset);
+
+            FontGlyph glyph = {};
+            glyph.codepoint = codepoint;
+            glyph.xOffset = static_cast<float>(xOffset);
+            glyph.yOffset = static_cast<float>(yOffset);
+            glyph.width = pixels ? static_cast<float>(width) : 0.0f;
+            glyph.height = pixels ? static_cast<float>(height) : 0.0f;
+            glyph.xAdvance = advance * scale;
+            glyphs.push_back(glyph);
+            bitmaps.push_back({ pixels, glyphIndex, pixels ? width : 0, pixels ? height : 0 });
+        }
+    }
+
+    if (glyphs.empty()) {
+        std::cerr << "[Font] Font has none of the requested glyphs" << std::endl;
+        return false;
+    }
+
+    // Pack into the smallest power-of-two atlas that fits, growing width
+    // and height in turn. Power-of-two widths also keep single-byte rows
+    // 4-byte aligned for the upload.
+    std::vector<stbrp_rect> rects;
+    for (size_t i = 0; i < bitmaps.size(); i++) {
+        if (!bitmaps[i].pixels) continue;
+        stbrp_rect rect = {};
+        rect.id = static_cast<int>(i);
+        rect.w = bitmaps[i].width + GLYPH_GUTTER;
+        rect.h = bitmaps[i].height + GLYPH_GUTTER;
+        rects.push_back(rect);
+    }
+
+    bool packed = false;
+    int width = MIN_ATLAS_SIZE;
+    int height = MIN_ATLAS_SIZE;
+    while (width <= settings.maxAtlasSize) {
+        std::vector<stbrp_node> nodes(width);
+        stbrp_context context;
+        stbrp_init_target(&context, width - GLYPH_GUTTER, height - GLYPH_GUTTER, nodes.data(),
+                          static_cast<int>(nodes.size()));
+        packed = stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size())) != 0;
+        if (packed) break;
+
+        if (height < width) {
+            height *= 2;
+        } else {
+            width *= 2;
+        }
+    }
+
+    if (packed) {
+        atlasWidth = width;
+        atlasHeight = height;
+        atlas.assign(static_cast<size_t>(width) * height, 0);
+
+        float invWidth = 1.0f / static_cast<float>(width);
+        float invHeight = 1.0f / static_cast<float>(height);
+        for (const stbrp_rect& rect : rects) {
+            const Bitmap& bitmap = bitmaps[rect.id];
+            int x = rect.x + GLYPH_GUTTER;
+            int y = rect.y + GLYPH_GUTTER;
+            for (int row = 0; row < bitmap.height; row++) {
+                std::memcpy(&atlas[static_cast<size_t>(y + row) * width + x],
+                            bitmap.pixels + row * bitmap.width, bitmap.width);
+            }
+
+            FontGlyph& glyph = glyphs[rect.id];
+            glyph.u0 = x * invWidth;
+            glyph.v0 = y * invHeight;
+            glyph.u1 = (x + bitmap.width) * invWidth;
+            glyph.v1 = (y + bitmap.height) * invHeight;
+        }
+    } else {
+        std::cerr << "[Font] Glyphs do not fit a " << settings.maxAtlasSize << " atlas" << std::endl;
+    }
+
+    for (const Bitmap& bitmap : bitmaps) {
+        if (bitmap.pixels) stbtt_FreeSDF(bitmap.pixels, nullptr);
+    }
+    if (!packed) return false;
+
+    // Pair kerning (kern or GPOS) between Latin-1 glyphs; wider ranges would
+    // make the quadratic scan too slow for a table that is rarely used
+    for (size_t left = 0; left < glyphs.size(); left++) {
+        if (glyphs[left].codepoint >= 256) continue;
+        for (size_t right = 0; right < glyphs.size(); right++) {
+            if (glyphs[right].codepoint >= 256) continue;
+            int advance = stbtt_GetGlyphKernAdvance(&info, bitmaps[left].glyphIndex, bitmaps[right].glyphIndex);
+            if (advance != 0) {
+                kerning[KerningKey(glyphs[left].codepoint, glyphs[right].codepoint)] = advance * scale;
+            }
+        }
+    }
+    return true;
+}
+
+bool Font::ReadCache(const std::string& cachePath, uint64_t sourceHash, bool checkSource, uint64_t settingsHash) {
+    Platform::MappedFile file;
+    if (!file.Open(cachePath)) return false;
+
+    BinaryReader reader(file.GetData(), file.GetSize());
+    CacheHeader header = reader.Read<CacheHeader>();
+    if (!reader.IsOk() || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION ||
+        header.settingsHash != settingsHash || (checkSource && header.sourceHash != sourceHash)) {
+        return false;
+    }
+
+    size_t atlasSize = static_cast<size_t>(header.atlasWidth) * header.atlasHeight;
+    const uint8_t* glyphData = reader.Take(header.glyphCount * sizeof(FontGlyph));
+    const uint8_t* kerningData = reader.Take(header.kerningCount * sizeof(KerningRecord));
+    const uint8_t* atlasData = reader.Take(atlasSize);
+    if (!reader.IsOk() || header.glyphCount == 0) {
+        std::cerr << "[Font] Truncated font cache: " << cachePath << std::endl;
+        return false;
+    }
+
+    glyphs.resize(header.glyphCount);
+    std::memcpy(glyphs.data(), glyphData, header.glyphCount * sizeof(FontGlyph));
+
+    for (uint32_t i = 0; i < header.kerningCount; i++) {
+        KerningRecord record;
+        std::memcpy(&record, kerningData + i * sizeof(KerningRecord), sizeof(record));
+        kerning[KerningKey(record.left, record.right)] = record.advance;
+    }
+
+    atlas.assign(atlasData, atlasData + atlasSize);
+    atlasWidth = header.atlasWidth;
+    atlasHeight = header.atlasHeight;
+    bakeSize = header.bakeSize;
+    ascent = header.ascent;
+    descent = header.descent;
+    lineGap = header.lineGap;
+    return true;
+}
+
+bool Font::WriteCache(const std::string& cachePath, uint64_t sourceHash, uint64_t settingsHash) const {
+    CacheHeader header = {};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.sourceHash = sourceHash;
+    header.settingsHash = settingsHash;
+    header.bakeSize = bakeSize;
+    header.ascent = ascent;
+    header.descent = descent;
+    header.lineGap = lineGap;
+    header.atlasWidth = atlasWidth;
+    header.atlasHeight = atlasHeight;
+    header.glyphCount = static_cast<uint32_t>(glyphs.size());
+    header.kerningCount = static_cast<uint32_t>(kerning.size());
+
+    BinaryWriter writer;
+    writer.Write(header);
+    writer.WriteBytes(glyphs.data(), glyphs.size() * sizeof(FontGlyph));
+    for (const auto& pair : kerning) {
+        KerningRecord record = { static_cast<uint32_t>(pair.first >> 32),
+                                 static_cast<uint32_t>(pair.first & 0xFFFFFFFFu), pair.second };
+        writer.Write(record);
+    }
+    writer.WriteBytes(atlas.data(), atlas.size());
+
+    std::ofstream out(cachePath, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "[Font] Failed to write font cache: " << cachePath << std::endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(writer.GetBuffer().data()),
+              static_cast<std::streamsize>(writer.GetSize()));
+    return true;
+}
+
+void Font::BuildLookup() {
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        uint32_t codepoint = glyphs[i].codepoint;
+        if (codepoint < 256) {
+            latin[codepoint] = static_cast<int>(i);
+        } else {
+            otherGlyphs[codepoint] = static_cast<int>(i);
+        }
+    }
+}
+
+const FontGlyph* Font::FindGlyph(uint32_t codepoint) const {
+    if (codepoint < 256) {
+        int index = latin[codepoint];
+        return index >= 0 ? &glyphs[index] : nullptr;
+    }
+    auto it = otherGlyphs.find(codepoint);
+    return it != otherGlyphs.end() ? &glyphs[it->second] : nullptr;
+}
+
+float Font::GetKerning(uint32_t left, uint32_t right) const {
+    if (kerning.empty()) return 0.0f;
+    auto it = kerning.find(KerningKey(left, right));
+    return it != kerning.end() ? it->second : 0.0f;
+}
+
+void Font::Layout(const std::string& text, float x, float y, float size, const Color& color,
+                  std::vector<SpriteVertex>& out) const {
+    if (glyphs.empty()) return;
+
+    float scale = size / bakeSize;
+    float lineHeight = GetLineHeight(size);
+    float cursorX = x;
+    float baseline = y + ascent * scale;
+    uint32_t previous = 0;
+
+    const char* it = text.data();
+    const char* end = it + text.size();
+    while (it < end) {
+        uint32_t codepoint = Utf8::Decode(it, end);
+        if (codepoint == '\n') {
+            cursorX = x;
+            baseline += lineHeight;
+            previous = 0;
+            continue;
+        }
+
+        const FontGlyph* glyph = FindGlyph(codepoint);
+        if (!glyph) glyph = FindGlyph('?');
+        if (!glyph) continue;
+
+        if (previous) cursorX += GetKerning(previous, glyph->codepoint) * scale;
+        previous = glyph->codepoint;
+
+        if (glyph->width > 0.0f) {
+            // Counter-clockwise from the glyph's top-left, matching SpriteBatch
+            float x0 = cursorX + glyph->xOffset * scale;
+            float y0 = baseline + glyph->yOffset * scale;
+            float x1 = x0 + glyph->width * scale;
+            float y1 = y0 + glyph->height * scale;
+
+            out.push_back({ x0, y0, glyph->u0, glyph->v0, color.r, color.g, color.b, color.a });
+            out.push_back({ x1, y0, glyph->u1, glyph->v0, color.r, color.g, color.b, color.a });
+            out.push_back({ x1, y1, glyph->u1, glyph->v1, color.r, color.g, color.b, color.a });
+            out.push_back({ x0, y1, glyph->u0, glyph->v1, color.r, color.g, color.b, color.a });
+        }
+
+        cursorX += glyph->xAdvance * scale;
+    }
+}
+
+float Font::GetTextWidth(const std::string& text, float size) const {
+    float width = 0.0f;
+    float maxWidth = 0.0f;
+    uint32_t previous = 0;
+
+    const char* it = text.data();
+    const char* end = it + text.size();
+    while (it < end) {
+        uint32_t codepoint = Utf8::Decode(it, end);
+        if (codepoint == '\n') {
+            maxWidth = std::max(maxWidth, width);
+            width = 0.0f;
+            previous = 0;
+            continue;
+        }
+
+        const FontGlyph* glyph = FindGlyph(codepoint);
+        if (!glyph) glyph = FindGlyph('?');
+        if (!glyph) continue;
+
+        if (previous) width += GetKerning(previous, glyph->codepoint);
+        previous = glyph->codepoint;
+        width += glyph->xAdvance;
+    }
+
+    return std::max(maxWidth, width) * size / bakeSize;
+}
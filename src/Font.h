@@ -0,0 +1,104 @@
+#ifndef MOLGA_FONT_H
+#define MOLGA_FONT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Common/Types.h"
+#include "SpriteBatch.h"
+
+class Texture;
+
+// How a TTF is turned into a glyph atlas. Changing any of these re-bakes
+// the cached atlas.
+struct FontImportSettings {
+    float bakeSize = 48.0f;     // Pixel height the distance field is sampled at
+    int padding = 6;            // Distance field spread around each glyph, in atlas pixels
+    int maxAtlasSize = 4096;
+
+    // Inclusive code point ranges to bake. Empty: printable Latin-1.
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+};
+
+// One baked glyph. Metrics are in bake-size pixels, y down from the baseline.
+struct FontGlyph {
+    uint32_t codepoint;
+    float u0, v0, u1, v1;
+    float xOffset, yOffset;     // Quad top-left relative to the pen position
+    float width, height;
+    float xAdvance;
+};
+
+// TrueType font rasterized once into a single-channel signed distance field
+// atlas. Because the atlas stores distances rather than coverage, the same
+// glyphs stay sharp at any size when drawn with Shaders/sdf_text.frag, so
+// one texture serves every size and a text block is one batched draw.
+//
+// The bake is cached next to the font (GetCachePath) and reused as long as
+// the TTF and the import settings are unchanged; the cache ships with the
+// project's assets, so the runtime never rasterizes.
+//
+//   Font font;
+//   font.Load(Project::Get().GetAssetsPath() + "/Fonts/Lato-Regular.ttf");
+//   TextRenderer::Get().RenderText(renderer, font, "Hello", 10.0f, 10.0f, 32.0f);
+class Font {
+public:
+    Font();
+    ~Font();
+
+    Font(const Font&) = delete;
+    Font& operator=(const Font&) = delete;
+
+    // Load from the cache, or bake (and write the cache) when it is missing
+    // or stale. Works without the TTF as long as a cache exists.
+    bool Load(const std::string& path, const FontImportSettings& settings = FontImportSettings());
+    void Unload();
+
+    bool IsLoaded() const { return !glyphs.empty(); }
+
+    static std::string GetCachePath(const std::string& fontPath) { return fontPath + ".sdf"; }
+
+    // Append one quad per glyph, top-left of the first line at (x, y) and
+    // size pixels per line of text, to out. text is UTF-8.
+    void Layout(const std::string& text, float x, float y, float size, const Color& color,
+                std::vector<SpriteVertex>& out) const;
+
+    float GetTextWidth(const std::string& text, float size) const;
+    float GetLineHeight(float size) const { return (ascent - descent + lineGap) * size / bakeSize; }
+
+    // nullptr when the code point was not baked
+    const FontGlyph* FindGlyph(uint32_t codepoint) const;
+
+    Texture* GetTexture() const { return texture.get(); }
+    int GetGlyphCount() const { return static_cast<int>(glyphs.size()); }
+    int GetAtlasWidth() const { return atlasWidth; }
+    int GetAtlasHeight() const { return atlasHeight; }
+
+private:
+    bool Bake(const unsigned char* ttf, const FontImportSettings& settings);
+    bool ReadCache(const std::string& cachePath, uint64_t sourceHash, bool checkSource, uint64_t settingsHash);
+    bool WriteCache(const std::string& cachePath, uint64_t sourceHash, uint64_t settingsHash) const;
+    void BuildLookup();
+
+    float GetKerning(uint32_t left, uint32_t right) const;
+
+    std::vector<FontGlyph> glyphs;
+    int latin[256];                                     // Index into glyphs, -1 if not baked
+    std::unordered_map<uint32_t, int> otherGlyphs;      // Code points above Latin-1
+    std::unordered_map<uint64_t, float> kerning;        // (left << 32 | right) -> bake pixels
+
+    std::vector<uint8_t> atlas;                         // Distance field, one byte per pixel
+    std::unique_ptr<Texture> texture;
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+
+    float bakeSize = 48.0f;
+    float ascent = 0.0f;                                // Bake pixels above the baseline
+    float descent = 0.0f;                               // Negative, below the baseline
+    float lineGap = 0.0f;
+};
+
+#endif // MOLGA_FONT_H
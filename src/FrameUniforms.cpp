@@ -0,0 +1,54 @@
+#include "FrameUniforms.h"
+#include "RenderBackend.h"
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstring>
+
+unsigned int FrameUniforms::ubo = 0;
+FrameData FrameUniforms::data = {};
+int FrameUniforms::uploadCount = 0;
+
+void FrameUniforms::Init() {
+    if (ubo || RenderBackend::IsNull()) return;
+
+    glGenBuffers(1, &ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameData), &data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo);
+}
+
+void FrameUniforms::Shutdown() {
+    if (ubo) {
+        glDeleteBuffers(1, &ubo);
+        ubo = 0;
+    }
+}
+
+void FrameUniforms::SetProjection(const float* matrix) {
+    if (ubo && std::memcmp(data.projection, matrix, sizeof(data.projection)) == 0) return;
+
+    std::memcpy(data.projection, matrix, sizeof(data.projection));
+    Upload(offsetof(FrameData, projection), sizeof(data.projection));
+}
+
+void FrameUniforms::SetTime(float time) {
+    if (ubo && data.time == time) return;
+
+    data.time = time;
+    Upload(offsetof(FrameData, time), sizeof(data.time));
+}
+
+void FrameUniforms::Upload(unsigned int offset, unsigned int size) {
+    if (!ubo) {
+        // Init uploads the whole block
+        Init();
+        uploadCount++;
+        return;
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, reinterpret_cast<const char*>(&data) + offset);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    uploadCount++;
+}
@@ -0,0 +1,38 @@
+#ifndef MOLGA_FRAME_UNIFORMS_H
+#define MOLGA_FRAME_UNIFORMS_H
+
+// CPU mirror of the std140 "FrameData" uniform block declared by the
+// engine shaders. One buffer is bound to BINDING and shared by every
+// program, so per-frame values are uploaded once instead of per shader.
+struct FrameData {
+    float projection[16];  // projection * view, column-major
+    float time;
+    float padding[3];      // std140 rounds the block up to 16 bytes
+};
+
+class FrameUniforms {
+public:
+    static constexpr unsigned int BINDING = 0;
+    static constexpr const char* BLOCK_NAME = "FrameData";
+
+    static void Init();
+    static void Shutdown();
+
+    // Uploads are skipped when the value is unchanged
+    static void SetProjection(const float* matrix);
+    static void SetTime(float time);
+
+    static const float* GetProjection() { return data.projection; }
+
+    static int GetUploadCount() { return uploadCount; }
+    static void ResetStats() { uploadCount = 0; }
+
+private:
+    static void Upload(unsigned int offset, unsigned int size);
+
+    static unsigned int ubo;
+    static FrameData data;
+    static int uploadCount;
+};
+
+#endif // MOLGA_FRAME_UNIFORMS_H
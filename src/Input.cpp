@@ -27,12 +27,17 @@ void Input::Init(GLFWwindow* win) {
     std::memset(currentMouseButtons, false, sizeof(currentMouseButtons));
     std::memset(previousMouseButtons, false, sizeof(previousMouseButtons));
 
+    // Headless: no window, every query reports nothing pressed
+#ifndef MOLGA_HEADLESS
+    if (!window) return;
+
     double mx, my;
     glfwGetCursorPos(window, &mx, &my);
     mouseX = lastMouseX = static_cast<float>(mx);
     mouseY = lastMouseY = static_cast<float>(my);
 
     glfwSetScrollCallback(window, ScrollCallback);
+#endif
 }
 
 void Input::Update() {
@@ -40,6 +45,9 @@ void Input::Update() {
     std::memcpy(previousKeys, currentKeys, sizeof(currentKeys));
     std::memcpy(previousMouseButtons, currentMouseButtons, sizeof(currentMouseButtons));
 
+#ifndef MOLGA_HEADLESS
+    if (!window) return;
+
     // Update keyboard state
     for (int i = 0; i < MAX_KEYS; i++) {
         currentKeys[i] = glfwGetKey(window, i) == GLFW_PRESS;
@@ -61,6 +69,7 @@ void Input::Update() {
 
     lastMouseX = mouseX;
     lastMouseY = mouseY;
+#endif
 
     // Reset scroll (scroll is event-based, so reset after each frame)
     scrollX = 0.0f;
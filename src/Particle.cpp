@@ -3,12 +3,198 @@
 #include "Shader.h"
 #include "Camera2D.h"
 #include "Sprite.h"
+#include "FrameUniforms.h"
+#include "Core/Profiler.h"
+#include "Core/JobSystem.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <new>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MOLGA_PARTICLE_SSE2
+#endif
+
+// ============ ParticlePool ============
+
+// Arrays are padded to a multiple of this so the SIMD kernel never needs a
+// scalar tail loop (lanes past the live range are dead and never read)
+static constexpr int POOL_ALIGN_FLOATS = 8;
+static constexpr std::align_val_t POOL_ALIGNMENT{32};
+
+ParticlePool::~ParticlePool() {
+    if (block) {
+        ::operator delete(block, POOL_ALIGNMENT);
+    }
+}
+
+void ParticlePool::Resize(int newCapacity) {
+    if (block) {
+        ::operator delete(block, POOL_ALIGNMENT);
+        block = nullptr;
+    }
+
+    capacity = newCapacity > 0 ? newCapacity : 0;
+    count = 0;
+
+    int stride = (capacity + POOL_ALIGN_FLOATS - 1) / POOL_ALIGN_FLOATS * POOL_ALIGN_FLOATS;
+    if (stride == 0) stride = POOL_ALIGN_FLOATS;
+
+    block = static_cast<float*>(::operator new(sizeof(float) * stride * NUM_ARRAYS, POOL_ALIGNMENT));
+    std::fill(block, block + stride * NUM_ARRAYS, 0.0f);
+
+    float** arrays[NUM_ARRAYS] = {
+        &x, &y, &vx, &vy, &size, &rotation, &rotationSpeed, &life, &invMaxLife, &r, &g, &b, &a
+    };
+    for (int i = 0; i < NUM_ARRAYS; i++) {
+        *arrays[i] = block + stride * i;
+    }
+}
+
+int ParticlePool::Emit() {
+    if (count >= capacity) return -1;
+    return count++;
+}
+
+void ParticlePool::Kill(int index) {
+    int last = --count;
+    if (index == last) return;
+
+    x[index] = x[last];
+    y[index] = y[last];
+    vx[index] = vx[last];
+    vy[index] = vy[last];
+    size[index] = size[last];
+    rotation[index] = rotation[last];
+    rotationSpeed[index] = rotationSpeed[last];
+    life[index] = life[last];
+    invMaxLife[index] = invMaxLife[last];
+    r[index] = r[last];
+    g[index] = g[last];
+    b[index] = b[last];
+    a[index] = a[last];
+}
+
+// ============ Update kernel ============
+
+namespace {
+
+// Integrate motion and interpolate size/color for particles [0, count).
+// lifeRatio goes from 1 (just born) to 0 (about to die), so every
+// start/end interpolation is end + (start - end) * lifeRatio. The SIMD
+// paths may run past count up to the padded capacity; those lanes are dead.
+#if defined(__AVX__)
+
+void UpdateParticles(ParticlePool& p, const ParticleConfig& c, float dt, int count) {
+    const __m256 vdt = _mm256_set1_ps(dt);
+    const __m256 gvx = _mm256_set1_ps(c.gravityX * dt);
+    const __m256 gvy = _mm256_set1_ps(c.gravityY * dt);
+    const __m256 sizeEnd = _mm256_set1_ps(c.endSize);
+    const __m256 sizeDelta = _mm256_set1_ps(c.startSize - c.endSize);
+    const __m256 rEnd = _mm256_set1_ps(c.endR), rDelta = _mm256_set1_ps(c.startR - c.endR);
+    const __m256 gEnd = _mm256_set1_ps(c.endG), gDelta = _mm256_set1_ps(c.startG - c.endG);
+    const __m256 bEnd = _mm256_set1_ps(c.endB), bDelta = _mm256_set1_ps(c.startB - c.endB);
+    const __m256 aEnd = _mm256_set1_ps(c.endA), aDelta = _mm256_set1_ps(c.startA - c.endA);
+
+    for (int i = 0; i < count; i += 8) {
+        __m256 life = _mm256_sub_ps(_mm256_load_ps(p.life + i), vdt);
+        _mm256_store_ps(p.life + i, life);
+        __m256 ratio = _mm256_mul_ps(life, _mm256_load_ps(p.invMaxLife + i));
+
+        __m256 vx = _mm256_add_ps(_mm256_load_ps(p.vx + i), gvx);
+        __m256 vy = _mm256_add_ps(_mm256_load_ps(p.vy + i), gvy);
+        _mm256_store_ps(p.vx + i, vx);
+        _mm256_store_ps(p.vy + i, vy);
+        _mm256_store_ps(p.x + i, _mm256_add_ps(_mm256_load_ps(p.x + i), _mm256_mul_ps(vx, vdt)));
+        _mm256_store_ps(p.y + i, _mm256_add_ps(_mm256_load_ps(p.y + i), _mm256_mul_ps(vy, vdt)));
+        _mm256_store_ps(p.rotation + i, _mm256_add_ps(_mm256_load_ps(p.rotation + i),
+                                                      _mm256_mul_ps(_mm256_load_ps(p.rotationSpeed + i), vdt)));
+
+        _mm256_store_ps(p.size + i, _mm256_add_ps(sizeEnd, _mm256_mul_ps(sizeDelta, ratio)));
+        _mm256_store_ps(p.r + i, _mm256_add_ps(rEnd, _mm256_mul_ps(rDelta, ratio)));
+        _mm256_store_ps(p.g + i, _mm256_add_ps(gEnd, _mm256_mul_ps(gDelta, ratio)));
+        _mm256_store_ps(p.b + i, _mm256_add_ps(bEnd, _mm256_mul_ps(bDelta, ratio)));
+        _mm256_store_ps(p.a + i, _mm256_add_ps(aEnd, _mm256_mul_ps(aDelta, ratio)));
+    }
+}
+
+#elif defined(MOLGA_PARTICLE_SSE2)
+
+void UpdateParticles(ParticlePool& p, const ParticleConfig& c, float dt, int count) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 gvx = _mm_set1_ps(c.gravityX * dt);
+    const __m128 gvy = _mm_set1_ps(c.gravityY * dt);
+    const __m128 sizeEnd = _mm_set1_ps(c.endSize);
+    const __m128 sizeDelta = _mm_set1_ps(c.startSize - c.endSize);
+    const __m128 rEnd = _mm_set1_ps(c.endR), rDelta = _mm_set1_ps(c.startR - c.endR);
+    const __m128 gEnd = _mm_set1_ps(c.endG), gDelta = _mm_set1_ps(c.startG - c.endG);
+    const __m128 bEnd = _mm_set1_ps(c.endB), bDelta = _mm_set1_ps(c.startB - c.endB);
+    const __m128 aEnd = _mm_set1_ps(c.endA), aDelta = _mm_set1_ps(c.startA - c.endA);
+
+    for (int i = 0; i < count; i += 4) {
+        __m128 life = _mm_sub_ps(_mm_load_ps(p.life + i), vdt);
+        _mm_store_ps(p.life + i, life);
+        __m128 ratio = _mm_mul_ps(life, _mm_load_ps(p.invMaxLife + i));
+
+        __m128 vx = _mm_add_ps(_mm_load_ps(p.vx + i), gvx);
+        __m128 vy = _mm_add_ps(_mm_load_ps(p.vy + i), gvy);
+        _mm_store_ps(p.vx + i, vx);
+        _mm_store_ps(p.vy + i, vy);
+        _mm_store_ps(p.x + i, _mm_add_ps(_mm_load_ps(p.x + i), _mm_mul_ps(vx, vdt)));
+        _mm_store_ps(p.y + i, _mm_add_ps(_mm_load_ps(p.y + i), _mm_mul_ps(vy, vdt)));
+        _mm_store_ps(p.rotation + i, _mm_add_ps(_mm_load_ps(p.rotation + i),
+                                                _mm_mul_ps(_mm_load_ps(p.rotationSpeed + i), vdt)));
+
+        _mm_store_ps(p.size + i, _mm_add_ps(sizeEnd, _mm_mul_ps(sizeDelta, ratio)));
+        _mm_store_ps(p.r + i, _mm_add_ps(rEnd, _mm_mul_ps(rDelta, ratio)));
+        _mm_store_ps(p.g + i, _mm_add_ps(gEnd, _mm_mul_ps(gDelta, ratio)));
+        _mm_store_ps(p.b + i, _mm_add_ps(bEnd, _mm_mul_ps(bDelta, ratio)));
+        _mm_store_ps(p.a + i, _mm_add_ps(aEnd, _mm_mul_ps(aDelta, ratio)));
+    }
+}
+
+#else
+
+void UpdateParticles(ParticlePool& p, const ParticleConfig& c, float dt, int count) {
+    float gvx = c.gravityX * dt;
+    float gvy = c.gravityY * dt;
+
+    for (int i = 0; i < count; i++) {
+        p.life[i] -= dt;
+        float lifeRatio = p.life[i] * p.invMaxLife[i];
+
+        p.vx[i] += gvx;
+        p.vy[i] += gvy;
+        p.x[i] += p.vx[i] * dt;
+        p.y[i] += p.vy[i] * dt;
+        p.rotation[i] += p.rotationSpeed[i] * dt;
+
+        p.size[i] = c.endSize + (c.startSize - c.endSize) * lifeRatio;
+        p.r[i] = c.endR + (c.startR - c.endR) * lifeRatio;
+        p.g[i] = c.endG + (c.startG - c.endG) * lifeRatio;
+        p.b[i] = c.endB + (c.startB - c.endB) * lifeRatio;
+        p.a[i] = c.endA + (c.startA - c.endA) * lifeRatio;
+    }
+}
+
+#endif
+
+} // namespace
+
+// ============ ParticleEmitter ============
 
 ParticleEmitter::ParticleEmitter()
-    : x(0), y(0), emitting(false), spawnAccumulator(0) {
+    : x(0), y(0), emitting(false), spawnAccumulator(0), VAO(0), quadVBO(0), instanceVBO(0) {
+    // Seeded from rand() so srand() still makes runs repeatable; never zero
+    randomState = static_cast<uint32_t>(rand()) * 2654435761u | 1u;
 }
 
 ParticleEmitter::~ParticleEmitter() {
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+    if (quadVBO) glDeleteBuffers(1, &quadVBO);
+    if (instanceVBO) glDeleteBuffers(1, &instanceVBO);
 }
 
 void ParticleEmitter::SetPosition(float x, float y) {
@@ -18,10 +204,7 @@ void ParticleEmitter::SetPosition(float x, float y) {
 
 void ParticleEmitter::SetConfig(const ParticleConfig& config) {
     this->config = config;
-    particles.resize(config.maxParticles);
-    for (auto& p : particles) {
-        p.active = false;
-    }
+    particles.Resize(config.maxParticles);
 }
 
 void ParticleEmitter::Start() {
@@ -39,48 +222,54 @@ void ParticleEmitter::Burst(int count) {
 }
 
 float ParticleEmitter::RandomFloat(float min, float max) {
-    return min + static_cast<float>(rand()) / RAND_MAX * (max - min);
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    // Top 24 bits as a float in [0, 1)
+    return min + static_cast<float>(randomState >> 8) * (1.0f / 16777216.0f) * (max - min);
 }
 
 void ParticleEmitter::EmitParticle() {
-    for (auto& p : particles) {
-        if (!p.active) {
-            // Position with variance
-            float angle = RandomFloat(0, 6.28318f);
-            float radius = RandomFloat(0, config.spawnRadius);
-            p.x = x + cos(angle) * radius;
-            p.y = y + sin(angle) * radius;
-
-            // Velocity
-            float speed = RandomFloat(config.minSpeed, config.maxSpeed);
-            float velAngle = RandomFloat(config.minAngle, config.maxAngle);
-            p.vx = cos(velAngle) * speed;
-            p.vy = sin(velAngle) * speed;
-
-            // Size
-            p.size = config.startSize + RandomFloat(-config.sizeVariance, config.sizeVariance);
-
-            // Rotation
-            p.rotation = RandomFloat(0, 6.28318f);
-            p.rotationSpeed = RandomFloat(config.minRotationSpeed, config.maxRotationSpeed);
-
-            // Life
-            p.maxLife = RandomFloat(config.minLife, config.maxLife);
-            p.life = p.maxLife;
-
-            // Color (start values)
-            p.r = config.startR;
-            p.g = config.startG;
-            p.b = config.startB;
-            p.a = config.startA;
-
-            p.active = true;
-            break;
-        }
-    }
+    int i = particles.Emit();
+    if (i < 0) return;
+
+    ParticlePool& p = particles;
+
+    // Position with variance
+    float angle = RandomFloat(0, 6.28318f);
+    float radius = RandomFloat(0, config.spawnRadius);
+    p.x[i] = x + cos(angle) * radius;
+    p.y[i] = y + sin(angle) * radius;
+
+    // Velocity
+    float speed = RandomFloat(config.minSpeed, config.maxSpeed);
+    float velAngle = RandomFloat(config.minAngle, config.maxAngle);
+    p.vx[i] = cos(velAngle) * speed;
+    p.vy[i] = sin(velAngle) * speed;
+
+    // Size
+    p.size[i] = config.startSize + RandomFloat(-config.sizeVariance, config.sizeVariance);
+
+    // Rotation
+    p.rotation[i] = RandomFloat(0, 6.28318f);
+    p.rotationSpeed[i] = RandomFloat(config.minRotationSpeed, config.maxRotationSpeed);
+
+    // Life
+    float maxLife = RandomFloat(config.minLife, config.maxLife);
+    p.life[i] = maxLife;
+    p.invMaxLife[i] = maxLife > 0.0f ? 1.0f / maxLife : 0.0f;
+
+    // Color (start values)
+    p.r[i] = config.startR;
+    p.g[i] = config.startG;
+    p.b[i] = config.startB;
+    p.a[i] = config.startA;
 }
 
 void ParticleEmitter::Update(float dt) {
+    MOLGA_PROFILE("ParticleEmitter::Update");
+
     // Spawn new particles
     if (emitting) {
         spawnAccumulator += config.spawnRate * dt;
@@ -90,66 +279,139 @@ void ParticleEmitter::Update(float dt) {
         }
     }
 
-    // Update existing particles
-    for (auto& p : particles) {
-        if (!p.active) continue;
-
-        // Update life
-        p.life -= dt;
-        if (p.life <= 0) {
-            p.active = false;
-            continue;
-        }
-
-        // Life ratio (1 = just born, 0 = about to die)
-        float lifeRatio = p.life / p.maxLife;
-        float deathRatio = 1.0f - lifeRatio;
+    int count = particles.GetCount();
+    if (count == 0) return;
 
-        // Apply gravity
-        p.vx += config.gravityX * dt;
-        p.vy += config.gravityY * dt;
+    // Integrate and interpolate every live particle without branching
+    UpdateParticles(particles, config, dt, count);
 
-        // Update position
-        p.x += p.vx * dt;
-        p.y += p.vy * dt;
-
-        // Update rotation
-        p.rotation += p.rotationSpeed * dt;
+    // Compact: swap-remove expired particles so the live range stays dense
+    int i = 0;
+    while (i < particles.GetCount()) {
+        if (particles.life[i] <= 0.0f) {
+            particles.Kill(i);
+        } else {
+            i++;
+        }
+    }
+}
 
-        // Interpolate size
-        p.size = config.startSize * lifeRatio + config.endSize * deathRatio;
+void ParticleEmitter::UpdateAll(ParticleEmitter* const* emitters, size_t count, float dt) {
+    MOLGA_PROFILE("ParticleEmitter::UpdateAll");
 
-        // Interpolate color
-        p.r = config.startR * lifeRatio + config.endR * deathRatio;
-        p.g = config.startG * lifeRatio + config.endG * deathRatio;
-        p.b = config.startB * lifeRatio + config.endB * deathRatio;
-        p.a = config.startA * lifeRatio + config.endA * deathRatio;
-    }
+    JobSystem::Get().ParallelFor(count, 1, [emitters, dt](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            emitters[i]->Update(dt);
+        }
+    });
 }
 
 void ParticleEmitter::Render(Renderer* renderer, Shader* shader, Camera2D* camera) {
-    renderer->Begin(shader, camera);
+    MOLGA_PROFILE("ParticleEmitter::Render");
+    MOLGA_ASSERT_MAIN_THREAD("ParticleEmitter::Render");
+    MOLGA_PROFILE_GPU("Particles");
+
+    Shader* particleShader = renderer->GetParticleShader();
+    if (particleShader) {
+        RenderInstanced(renderer, particleShader, camera);
+        return;
+    }
 
-    for (const auto& p : particles) {
-        if (!p.active) continue;
+    renderer->Begin(shader, camera);
 
+    const ParticlePool& p = particles;
+    for (int i = 0; i < p.GetCount(); i++) {
         Sprite sprite;
-        sprite.SetPosition(p.x - p.size / 2, p.y - p.size / 2);
-        sprite.SetSize(p.size, p.size);
-        sprite.SetColor(p.r, p.g, p.b, p.a);
-        sprite.SetRotation(p.rotation);
+        sprite.SetPosition(p.x[i] - p.size[i] / 2, p.y[i] - p.size[i] / 2);
+        sprite.SetSize(p.size[i], p.size[i]);
+        sprite.SetColor(p.r[i], p.g[i], p.b[i], p.a[i]);
+        sprite.SetRotation(p.rotation[i]);
         renderer->DrawSprite(&sprite);
     }
 
     renderer->End();
 }
 
-int ParticleEmitter::GetActiveCount() const {
-    int count = 0;
-    for (const auto& p : particles) {
-        if (p.active) count++;
+void ParticleEmitter::SetupInstanceBuffers() {
+    // Unit quad centered on the origin, scaled and rotated per instance
+    float quad[] = {
+        -0.5f, -0.5f,
+         0.5f, -0.5f,
+         0.5f,  0.5f,
+
+        -0.5f, -0.5f,
+         0.5f,  0.5f,
+        -0.5f,  0.5f
+    };
+
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &quadVBO);
+    glGenBuffers(1, &instanceVBO);
+
+    glBindVertexArray(VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STREAM_DRAW);
+
+    // Instance attribute: x, y, size, rotation
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, INSTANCE_FLOATS * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribDivisor(1, 1);
+
+    // Instance attribute: color
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, INSTANCE_FLOATS * sizeof(float), (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(2, 1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void ParticleEmitter::RenderInstanced(Renderer* renderer, Shader* particleShader, Camera2D* camera) {
+    // Pack live particles into the per-instance buffer
+    const ParticlePool& p = particles;
+    GLsizei instanceCount = static_cast<GLsizei>(p.GetCount());
+    if (instanceCount == 0) return;
+
+    instanceData.resize(instanceCount * INSTANCE_FLOATS);
+    float* out = instanceData.data();
+    for (int i = 0; i < instanceCount; i++) {
+        out[0] = p.x[i];
+        out[1] = p.y[i];
+        out[2] = p.size[i];
+        out[3] = p.rotation[i];
+        out[4] = p.r[i];
+        out[5] = p.g[i];
+        out[6] = p.b[i];
+        out[7] = p.a[i];
+        out += INSTANCE_FLOATS;
     }
-    return count;
+
+    if (!VAO) {
+        SetupInstanceBuffers();
+    }
+
+    mat4x4 projView;
+    renderer->GetProjectionView(camera, projView);
+
+    particleShader->Use();
+    FrameUniforms::SetProjection((float*)projView);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, instanceData.size() * sizeof(float), instanceData.data(), GL_STREAM_DRAW);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, instanceCount);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+int ParticleEmitter::GetActiveCount() const {
+    return particles.GetCount();
 }
 
 // ============ Presets ============
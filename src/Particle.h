@@ -5,21 +5,59 @@
 #include <functional>
 #include <cstdlib>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 class Renderer;
 class Shader;
 class Camera2D;
 
-struct Particle {
-    float x, y;           // Position
-    float vx, vy;         // Velocity
-    float size;           // Current size
-    float rotation;       // Rotation angle
-    float rotationSpeed;  // Rotation speed
-    float life;           // Remaining life (0-1)
-    float maxLife;        // Total lifetime
-    float r, g, b, a;     // Color
-    bool active;
+// Structure-of-arrays particle storage. Each attribute lives in its own
+// 32-byte aligned array so the update kernel can process several particles
+// per SIMD instruction. Live particles always occupy [0, count): dead ones
+// are swap-removed with the last live particle.
+class ParticlePool {
+public:
+    ParticlePool() = default;
+    ~ParticlePool();
+
+    ParticlePool(const ParticlePool&) = delete;
+    ParticlePool& operator=(const ParticlePool&) = delete;
+
+    // Reallocate for the given capacity (drops all live particles)
+    void Resize(int capacity);
+
+    // Claim a slot at the end of the live range, or -1 if full
+    int Emit();
+
+    // Remove a live particle by moving the last live particle into its slot
+    void Kill(int index);
+
+    void Clear() { count = 0; }
+
+    int GetCount() const { return count; }
+    int GetCapacity() const { return capacity; }
+
+    float* x = nullptr;
+    float* y = nullptr;
+    float* vx = nullptr;
+    float* vy = nullptr;
+    float* size = nullptr;
+    float* rotation = nullptr;
+    float* rotationSpeed = nullptr;
+    float* life = nullptr;        // Remaining life in seconds
+    float* invMaxLife = nullptr;  // 1 / total lifetime
+    float* r = nullptr;
+    float* g = nullptr;
+    float* b = nullptr;
+    float* a = nullptr;
+
+private:
+    static constexpr int NUM_ARRAYS = 13;
+
+    float* block = nullptr;
+    int capacity = 0;
+    int count = 0;
 };
 
 struct ParticleConfig {
@@ -72,6 +110,11 @@ public:
     void Burst(int count);  // Emit multiple particles at once
 
     void Update(float dt);
+
+    // Update distinct emitters in parallel on the JobSystem (serially when
+    // it is not running). Emitters share no state, so no locking is needed.
+    static void UpdateAll(ParticleEmitter* const* emitters, size_t count, float dt);
+
     void Render(Renderer* renderer, Shader* shader, Camera2D* camera = nullptr);
 
     bool IsActive() const { return emitting || GetActiveCount() > 0; }
@@ -85,8 +128,20 @@ private:
     void EmitParticle();
     float RandomFloat(float min, float max);
 
-    std::vector<Particle> particles;
+    // Instanced rendering: one draw call for all live particles
+    void RenderInstanced(Renderer* renderer, Shader* particleShader, Camera2D* camera);
+    void SetupInstanceBuffers();
+
+    ParticlePool particles;
     float spawnAccumulator;
+
+    // Per-emitter xorshift state: rand() is shared between threads
+    uint32_t randomState;
+
+    // Per-instance data: x, y, size, rotation, r, g, b, a
+    static constexpr int INSTANCE_FLOATS = 8;
+    std::vector<float> instanceData;
+    unsigned int VAO, quadVBO, instanceVBO;
 };
 
 // Preset particle effects
@@ -0,0 +1,57 @@
+#ifndef MOLGA_GRID_WALK_H
+#define MOLGA_GRID_WALK_H
+
+#include <cmath>
+#include <limits>
+#include "../Common/Types.h"
+
+// Visit the cells of a uniform grid a ray passes through, in order along
+// the ray (Amanatides & Woo, "A Fast Voxel Traversal Algorithm", 1987).
+//
+// direction must be unit length. visit(cellX, cellY, entryDistance) is
+// called for the start cell (entry 0) and every cell entered before
+// maxDistance, and returns false to stop the walk.
+template<typename F>
+void WalkGrid(const Vector2& origin, const Vector2& direction, float maxDistance, float cellSize, F&& visit) {
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    int x = static_cast<int>(std::floor(origin.x / cellSize));
+    int y = static_cast<int>(std::floor(origin.y / cellSize));
+    int stepX = direction.x > 0.0f ? 1 : (direction.x < 0.0f ? -1 : 0);
+    int stepY = direction.y > 0.0f ? 1 : (direction.y < 0.0f ? -1 : 0);
+
+    // Distance along the ray to the next vertical / horizontal cell
+    // boundary, and between two of them
+    float nextX = infinity, nextY = infinity;
+    float deltaX = infinity, deltaY = infinity;
+    if (stepX != 0) {
+        float boundary = (stepX > 0 ? x + 1 : x) * cellSize;
+        nextX = (boundary - origin.x) / direction.x;
+        deltaX = cellSize / std::fabs(direction.x);
+    }
+    if (stepY != 0) {
+        float boundary = (stepY > 0 ? y + 1 : y) * cellSize;
+        nextY = (boundary - origin.y) / direction.y;
+        deltaY = cellSize / std::fabs(direction.y);
+    }
+
+    if (!visit(x, y, 0.0f)) return;
+
+    while (true) {
+        float distance;
+        if (nextX < nextY) {
+            distance = nextX;
+            x += stepX;
+            nextX += deltaX;
+        } else {
+            distance = nextY;
+            y += stepY;
+            nextY += deltaY;
+        }
+
+        if (distance > maxDistance) return;
+        if (!visit(x, y, distance)) return;
+    }
+}
+
+#endif // MOLGA_GRID_WALK_H
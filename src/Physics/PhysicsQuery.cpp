@@ -0,0 +1,390 @@
+#include "PhysicsQuery.h"
+#include "PhysicsWorld.h"
+#include "GridWalk.h"
+#include "../Tilemap.h"
+#include "../ECS/Components/BoxCollider2D.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Commands per job in CastBatch
+constexpr size_t BATCH_GRAIN = 32;
+
+// Every cast is a ray from the shape's center tested against obstacles
+// grown by the shape (Minkowski sum): a box grows boxes by its half
+// extents, a circle turns them into rounded rectangles.
+
+// Ray vs box. Misses when the origin is inside, so casts ignore what they
+// start in.
+bool RayBox(const Vector2& origin, const Vector2& direction, float left, float top, float right, float bottom,
+            float maxDistance, float& outDistance, Vector2& outNormal) {
+    const float infinity = std::numeric_limits<float>::infinity();
+    float enter = -infinity;
+    float exit = infinity;
+    Vector2 normal;
+
+    if (direction.x == 0.0f) {
+        if (origin.x <= left || origin.x >= right) return false;
+    } else {
+        float near = ((direction.x > 0.0f ? left : right) - origin.x) / direction.x;
+        float far = ((direction.x > 0.0f ? right : left) - origin.x) / direction.x;
+        enter = near;
+        exit = far;
+        normal = Vector2(direction.x > 0.0f ? -1.0f : 1.0f, 0.0f);
+    }
+
+    if (direction.y == 0.0f) {
+        if (origin.y <= top || origin.y >= bottom) return false;
+    } else {
+        float near = ((direction.y > 0.0f ? top : bottom) - origin.y) / direction.y;
+        float far = ((direction.y > 0.0f ? bottom : top) - origin.y) / direction.y;
+        if (near > enter) {
+            enter = near;
+            normal = Vector2(0.0f, direction.y > 0.0f ? -1.0f : 1.0f);
+        }
+        exit = std::min(exit, far);
+    }
+
+    if (enter > exit || exit <= 0.0f || enter < 0.0f || enter > maxDistance) return false;
+
+    outDistance = enter;
+    outNormal = normal;
+    return true;
+}
+
+// Ray vs circle, from outside
+bool RayCircle(const Vector2& origin, const Vector2& direction, const Vector2& center, float radius,
+               float maxDistance, float& outDistance, Vector2& outNormal) {
+    Vector2 offset = origin - center;
+    float b = offset.x * direction.x + offset.y * direction.y;
+    float c = offset.x * offset.x + offset.y * offset.y - radius * radius;
+    if (c < 0.0f || b > 0.0f) return false;     // Inside, or moving away
+
+    float discriminant = b * b - c;
+    if (discriminant < 0.0f) return false;
+
+    float distance = std::max(-b - std::sqrt(discriminant), 0.0f);
+    if (distance > maxDistance) return false;
+
+    outDistance = distance;
+    outNormal = (offset + direction * distance) / radius;
+    return true;
+}
+
+// Circle of radius around origin vs box: ray vs the box grown into a
+// rounded rectangle, made of two crossed boxes and four corner circles
+bool RayRoundedBox(const Vector2& origin, const Vector2& direction, const AABB& box, float radius,
+                   float maxDistance, float& outDistance, Vector2& outNormal) {
+    const Vector2 corners[4] = {
+        Vector2(box.Left(), box.Top()), Vector2(box.Right(), box.Top()),
+        Vector2(box.Right(), box.Bottom()), Vector2(box.Left(), box.Bottom())
+    };
+
+    // Starting inside any part means starting inside the whole
+    bool insideWide = origin.x > box.Left() - radius && origin.x < box.Right() + radius &&
+                      origin.y > box.Top() && origin.y < box.Bottom();
+    bool insideTall = origin.x > box.Left() && origin.x < box.Right() &&
+                      origin.y > box.Top() - radius && origin.y < box.Bottom() + radius;
+    if (insideWide || insideTall) return false;
+    for (const Vector2& corner : corners) {
+        Vector2 offset = origin - corner;
+        if (offset.x * offset.x + offset.y * offset.y < radius * radius) return false;
+    }
+
+    bool hit = false;
+    float best = maxDistance;
+    float distance;
+    Vector2 normal;
+
+    if (RayBox(origin, direction, box.Left() - radius, box.Top(), box.Right() + radius, box.Bottom(),
+               best, distance, normal)) {
+        best = distance;
+        outNormal = normal;
+        hit = true;
+    }
+    if (RayBox(origin, direction, box.Left(), box.Top() - radius, box.Right(), box.Bottom() + radius,
+               best, distance, normal) && (!hit || distance < best)) {
+        best = distance;
+        outNormal = normal;
+        hit = true;
+    }
+    for (const Vector2& corner : corners) {
+        if (RayCircle(origin, direction, corner, radius, best, distance, normal) && (!hit || distance < best)) {
+            best = distance;
+            outNormal = normal;
+            hit = true;
+        }
+    }
+
+    outDistance = best;
+    return hit;
+}
+
+struct CastShape {
+    CastCommand::Shape kind;
+    float radius;
+    Vector2 halfExtents;        // Reach of the shape around its center
+};
+
+bool CastAgainst(const CastShape& shape, const Vector2& origin, const Vector2& direction, const AABB& box,
+                 float maxDistance, float& outDistance, Vector2& outNormal) {
+    switch (shape.kind) {
+        case CastCommand::Shape::Ray:
+            return RayBox(origin, direction, box.Left(), box.Top(), box.Right(), box.Bottom(),
+                          maxDistance, outDistance, outNormal);
+        case CastCommand::Shape::Box:
+            return RayBox(origin, direction, box.Left() - shape.halfExtents.x, box.Top() - shape.halfExtents.y,
+                          box.Right() + shape.halfExtents.x, box.Bottom() + shape.halfExtents.y,
+                          maxDistance, outDistance, outNormal);
+        case CastCommand::Shape::Circle:
+            return RayRoundedBox(origin, direction, box, shape.radius, maxDistance, outDistance, outNormal);
+    }
+    return false;
+}
+
+bool PassesFilter(const BoxCollider2D* collider, const QueryFilter& filter) {
+    return (collider->GetLayerMask() & filter.layerMask) != 0 && (filter.includeTriggers || !collider->IsTrigger());
+}
+
+// Past the map on an axis, further than the shape reaches, and not coming back
+bool LeftGrid(int cell, int step, int reach, int size) {
+    return (cell < -reach && step <= 0) || (cell >= size + reach && step >= 0);
+}
+
+int Sign(float value) {
+    return value > 0.0f ? 1 : (value < 0.0f ? -1 : 0);
+}
+
+} // namespace
+
+// Walks the grid cells the shape's center passes through; every obstacle
+// the shape can touch while its center is in a cell lies within reach
+// cells of it. Once the next cell is entered beyond the closest hit so far,
+// nothing closer remains.
+static void CastTiles(const Tilemap& tilemap, const CastShape& shape, const Vector2& origin,
+                      const Vector2& direction, float maxDistance, RaycastHit& hit) {
+    float tileSize = static_cast<float>(tilemap.GetTileSize());
+    int reachX = static_cast<int>(std::ceil(shape.halfExtents.x / tileSize));
+    int reachY = static_cast<int>(std::ceil(shape.halfExtents.y / tileSize));
+    int stepX = Sign(direction.x);
+    int stepY = Sign(direction.y);
+
+    WalkGrid(origin, direction, maxDistance, tileSize, [&](int cellX, int cellY, float entry) {
+        if (hit.hit && entry > hit.distance) return false;
+        if (LeftGrid(cellX, stepX, reachX, tilemap.GetWidth()) ||
+            LeftGrid(cellY, stepY, reachY, tilemap.GetHeight())) return false;
+
+        float best = hit.hit ? hit.distance : maxDistance;
+        for (int y = cellY - reachY; y <= cellY + reachY; y++) {
+            for (int x = cellX - reachX; x <= cellX + reachX; x++) {
+                if (!tilemap.IsSolid(x, y)) continue;
+
+                float distance;
+                Vector2 normal;
+                if (CastAgainst(shape, origin, direction, tilemap.GetTileAABB(x, y), best, distance, normal) &&
+                    (!hit.hit || distance < hit.distance)) {
+                    hit.hit = true;
+                    hit.collider = nullptr;
+                    hit.tileX = x;
+                    hit.tileY = y;
+                    hit.distance = distance;
+                    hit.normal = normal;
+                    best = distance;
+                }
+            }
+        }
+        return true;
+    });
+}
+
+static void CastColliders(const PhysicsWorld& world, const CastShape& shape, const Vector2& origin,
+                          const Vector2& direction, float maxDistance, const QueryFilter& filter,
+                          RaycastHit& hit) {
+    if (world.IsGridEmpty()) return;
+
+    float cellSize = world.GetCellSize();
+    int reachX = static_cast<int>(std::ceil(shape.halfExtents.x / cellSize));
+    int reachY = static_cast<int>(std::ceil(shape.halfExtents.y / cellSize));
+
+    WalkGrid(origin, direction, maxDistance, cellSize, [&](int cellX, int cellY, float entry) {
+        if (hit.hit && entry > hit.distance) return false;
+
+        float best = hit.hit ? hit.distance : maxDistance;
+        for (int y = cellY - reachY; y <= cellY + reachY; y++) {
+            for (int x = cellX - reachX; x <= cellX + reachX; x++) {
+                world.ForEachInCell(x, y, [&](BoxCollider2D* collider, const AABB& box) {
+                    if (!PassesFilter(collider, filter)) return;
+
+                    float distance;
+                    Vector2 normal;
+                    if (CastAgainst(shape, origin, direction, box, best, distance, normal) &&
+                        (!hit.hit || distance < hit.distance)) {
+                        hit.hit = true;
+                        hit.collider = collider;
+                        hit.tileX = -1;
+                        hit.tileY = -1;
+                        hit.distance = distance;
+                        hit.normal = normal;
+                        best = distance;
+                    }
+                });
+            }
+        }
+        return true;
+    });
+}
+
+bool PhysicsQuery::Cast(const CastCommand& command, RaycastHit& hit) {
+    hit = RaycastHit();
+
+    float length = std::sqrt(command.direction.x * command.direction.x + command.direction.y * command.direction.y);
+    float maxDistance = std::min(command.maxDistance, MAX_DISTANCE);
+    if (length == 0.0f || !(maxDistance >= 0.0f)) return false;
+    Vector2 direction = command.direction / length;
+
+    CastShape shape = { command.shape, 0.0f, Vector2() };
+    if (command.shape == CastCommand::Shape::Circle) {
+        shape.radius = command.radius;
+        shape.halfExtents = Vector2(command.radius, command.radius);
+    } else if (command.shape == CastCommand::Shape::Box) {
+        shape.halfExtents = command.halfExtents;
+    }
+
+    if (command.filter.tilemap) {
+        CastTiles(*command.filter.tilemap, shape, command.origin, direction, maxDistance, hit);
+    }
+    CastColliders(PhysicsWorld::Get(), shape, command.origin, direction,
+                  hit.hit ? hit.distance : maxDistance, command.filter, hit);
+
+    if (hit.hit) {
+        hit.point = command.origin + direction * hit.distance;
+    }
+    return hit.hit;
+}
+
+bool PhysicsQuery::Raycast(const Vector2& origin, const Vector2& direction, float maxDistance,
+                           RaycastHit& hit, const QueryFilter& filter) {
+    CastCommand command;
+    command.origin = origin;
+    command.direction = direction;
+    command.maxDistance = maxDistance;
+    command.filter = filter;
+    return Cast(command, hit);
+}
+
+bool PhysicsQuery::CircleCast(const Vector2& center, float radius, const Vector2& direction, float maxDistance,
+                              RaycastHit& hit, const QueryFilter& filter) {
+    CastCommand command;
+    command.shape = CastCommand::Shape::Circle;
+    command.origin = center;
+    command.radius = radius;
+    command.direction = direction;
+    command.maxDistance = maxDistance;
+    command.filter = filter;
+    return Cast(command, hit);
+}
+
+bool PhysicsQuery::BoxCast(const AABB& box, const Vector2& direction, float maxDistance,
+                           RaycastHit& hit, const QueryFilter& filter) {
+    CastCommand command;
+    command.shape = CastCommand::Shape::Box;
+    command.origin = box.Center();
+    command.halfExtents = box.Size() * 0.5f;
+    command.direction = direction;
+    command.maxDistance = maxDistance;
+    command.filter = filter;
+    return Cast(command, hit);
+}
+
+bool PhysicsQuery::LineOfSight(const Vector2& from, const Vector2& to, const QueryFilter& filter) {
+    Vector2 delta = to - from;
+    float distance = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+    if (distance == 0.0f) return true;
+
+    RaycastHit hit;
+    return !Raycast(from, delta, distance, hit, filter);
+}
+
+int PhysicsQuery::RaycastAll(const Vector2& origin, const Vector2& direction, float maxDistance,
+                             std::vector<RaycastHit>& hits, const QueryFilter& filter) {
+    float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    maxDistance = std::min(maxDistance, MAX_DISTANCE);
+    if (length == 0.0f || !(maxDistance >= 0.0f)) return 0;
+    Vector2 dir = direction / length;
+    size_t first = hits.size();
+
+    auto addHit = [&](BoxCollider2D* collider, int tileX, int tileY, float distance, const Vector2& normal) {
+        RaycastHit hit;
+        hit.hit = true;
+        hit.collider = collider;
+        hit.tileX = tileX;
+        hit.tileY = tileY;
+        hit.distance = distance;
+        hit.normal = normal;
+        hit.point = origin + dir * distance;
+        hits.push_back(hit);
+    };
+
+    if (const Tilemap* tilemap = filter.tilemap) {
+        int stepX = Sign(dir.x);
+        int stepY = Sign(dir.y);
+        WalkGrid(origin, dir, maxDistance, static_cast<float>(tilemap->GetTileSize()),
+                 [&](int cellX, int cellY, float) {
+            if (LeftGrid(cellX, stepX, 0, tilemap->GetWidth()) || LeftGrid(cellY, stepY, 0, tilemap->GetHeight())) {
+                return false;
+            }
+            if (!tilemap->IsSolid(cellX, cellY)) return true;
+
+            AABB tile = tilemap->GetTileAABB(cellX, cellY);
+            float distance;
+            Vector2 normal;
+            if (RayBox(origin, dir, tile.Left(), tile.Top(), tile.Right(), tile.Bottom(), maxDistance,
+                       distance, normal)) {
+                addHit(nullptr, cellX, cellY, distance, normal);
+            }
+            return true;
+        });
+    }
+
+    const PhysicsWorld& world = PhysicsWorld::Get();
+    if (!world.IsGridEmpty()) {
+        size_t firstCollider = hits.size();
+        WalkGrid(origin, dir, maxDistance, world.GetCellSize(), [&](int cellX, int cellY, float) {
+            world.ForEachInCell(cellX, cellY, [&](BoxCollider2D* collider, const AABB& box) {
+                if (!PassesFilter(collider, filter)) return;
+
+                // Colliders spanning several cells are met more than once
+                for (size_t i = firstCollider; i < hits.size(); i++) {
+                    if (hits[i].collider == collider) return;
+                }
+
+                float distance;
+                Vector2 normal;
+                if (RayBox(origin, dir, box.Left(), box.Top(), box.Right(), box.Bottom(), maxDistance,
+                           distance, normal)) {
+                    addHit(collider, -1, -1, distance, normal);
+                }
+            });
+            return true;
+        });
+    }
+
+    std::sort(hits.begin() + first, hits.end(), [](const RaycastHit& a, const RaycastHit& b) {
+        return a.distance < b.distance;
+    });
+    return static_cast<int>(hits.size() - first);
+}
+
+void PhysicsQuery::CastBatch(const CastCommand* commands, RaycastHit* results, size_t count) {
+    MOLGA_PROFILE("PhysicsQuery::CastBatch");
+
+    JobSystem::Get().ParallelFor(count, BATCH_GRAIN, [commands, results](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            Cast(commands[i], results[i]);
+        }
+    });
+}
@@ -0,0 +1,84 @@
+#ifndef MOLGA_PHYSICS_QUERY_H
+#define MOLGA_PHYSICS_QUERY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Common/Types.h"
+
+class BoxCollider2D;
+class Tilemap;
+
+struct RaycastHit {
+    bool hit = false;
+    BoxCollider2D* collider = nullptr;  // nullptr for tile hits
+    int tileX = -1;                     // Tile hits only
+    int tileY = -1;
+    Vector2 point;                      // origin + direction * distance: for shape
+                                        // casts the shape's center at impact
+    Vector2 normal;                     // Surface normal at the hit
+    float distance = 0.0f;
+};
+
+// What a query hits
+struct QueryFilter {
+    uint32_t layerMask = 0xFFFFFFFFu;   // BoxCollider2D layers (1 << layer)
+    bool includeTriggers = false;
+    const Tilemap* tilemap = nullptr;   // Also hit solid tiles of this map
+};
+
+// One query of a batch
+struct CastCommand {
+    enum class Shape { Ray, Circle, Box };
+
+    Shape shape = Shape::Ray;
+    Vector2 origin;                     // Ray origin, circle or box center
+    Vector2 direction;                  // Need not be normalized
+    float maxDistance = 0.0f;
+    float radius = 0.0f;                // Circle
+    Vector2 halfExtents;                // Box
+    QueryFilter filter;
+};
+
+// Ray and shape casts against BoxCollider2D objects (through the
+// PhysicsWorld broadphase) and optionally a Tilemap. Both are walked cell by
+// cell along the cast (Amanatides-Woo), so the cost depends on the distance
+// travelled, not on the number of colliders or tiles.
+//
+// Colliders are seen where the last PhysicsWorld::Step() put them. Shapes
+// that start inside a collider or solid tile do not hit it, so an NPC can
+// cast from inside its own collider. maxDistance is capped at MAX_DISTANCE.
+//
+// Queries only read, so any number may run at once (CastBatch runs them on
+// the JobSystem), but not while PhysicsWorld::Step or collider
+// registration runs.
+class PhysicsQuery {
+public:
+    static constexpr float MAX_DISTANCE = 100000.0f;
+
+    // Closest hit along the ray
+    static bool Raycast(const Vector2& origin, const Vector2& direction, float maxDistance,
+                        RaycastHit& hit, const QueryFilter& filter = QueryFilter());
+
+    // Every collider and solid tile the ray enters, nearest first, appended
+    // to hits. Returns the number appended.
+    static int RaycastAll(const Vector2& origin, const Vector2& direction, float maxDistance,
+                          std::vector<RaycastHit>& hits, const QueryFilter& filter = QueryFilter());
+
+    // Sweep a circle / box and report the first contact
+    static bool CircleCast(const Vector2& center, float radius, const Vector2& direction, float maxDistance,
+                           RaycastHit& hit, const QueryFilter& filter = QueryFilter());
+    static bool BoxCast(const AABB& box, const Vector2& direction, float maxDistance,
+                        RaycastHit& hit, const QueryFilter& filter = QueryFilter());
+
+    // Nothing blocks the segment between the points
+    static bool LineOfSight(const Vector2& from, const Vector2& to, const QueryFilter& filter = QueryFilter());
+
+    // Run count commands, writing results[i] for commands[i]. Split across
+    // the JobSystem threads when it is running.
+    static void CastBatch(const CastCommand* commands, RaycastHit* results, size_t count);
+
+    static bool Cast(const CastCommand& command, RaycastHit& hit);
+};
+
+#endif // MOLGA_PHYSICS_QUERY_H
@@ -0,0 +1,271 @@
+#include "PhysicsWorld.h"
+#include "../ECS/GameObject.h"
+#include "../ECS/Components/BoxCollider2D.h"
+#include "../Scripting/Script.h"
+#include "../Collision.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+PhysicsWorld& PhysicsWorld::Get() {
+    static PhysicsWorld instance;
+    return instance;
+}
+
+void PhysicsWorld::Register(BoxCollider2D* collider) {
+    if (!collider || collider->proxyId >= 0) return;
+
+    int id;
+    if (!freeProxies.empty()) {
+        id = freeProxies.back();
+        freeProxies.pop_back();
+    } else {
+        id = static_cast<int>(proxies.size());
+        proxies.emplace_back();
+    }
+
+    proxies[id] = Proxy();
+    proxies[id].collider = collider;
+    collider->proxyId = id;
+}
+
+void PhysicsWorld::Unregister(BoxCollider2D* collider) {
+    if (!collider || collider->proxyId < 0) return;
+
+    int id = collider->proxyId;
+    RemoveFromCells(id);
+    proxies[id].collider = nullptr;
+    freeProxies.push_back(id);
+    collider->proxyId = -1;
+
+    // The owner may be in the middle of being destroyed, so contacts are
+    // dropped without an Exit callback
+    for (auto it = contacts.begin(); it != contacts.end();) {
+        if (it->second.a == collider || it->second.b == collider) {
+            it = contacts.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // A script callback may destroy an object while events are dispatched
+    for (auto& event : events) {
+        if (event.a == collider || event.b == collider) {
+            event.a = nullptr;
+            event.b = nullptr;
+        }
+    }
+}
+
+void PhysicsWorld::Clear() {
+    for (auto& proxy : proxies) {
+        if (proxy.collider) proxy.collider->proxyId = -1;
+    }
+    proxies.clear();
+    freeProxies.clear();
+    cells.clear();
+    contacts.clear();
+    events.clear();
+}
+
+void PhysicsWorld::SetCellSize(float size) {
+    if (size <= 0.0f || size == cellSize) return;
+
+    cellSize = size;
+    cells.clear();
+    for (auto& proxy : proxies) {
+        proxy.inGrid = false;
+    }
+}
+
+void PhysicsWorld::InsertIntoCells(int id) {
+    Proxy& proxy = proxies[id];
+    for (int y = proxy.minY; y <= proxy.maxY; y++) {
+        for (int x = proxy.minX; x <= proxy.maxX; x++) {
+            cells[CellKey(x, y)].push_back(id);
+        }
+    }
+    proxy.inGrid = true;
+}
+
+void PhysicsWorld::RemoveFromCells(int id) {
+    Proxy& proxy = proxies[id];
+    if (!proxy.inGrid) return;
+
+    for (int y = proxy.minY; y <= proxy.maxY; y++) {
+        for (int x = proxy.minX; x <= proxy.maxX; x++) {
+            auto it = cells.find(CellKey(x, y));
+            if (it == cells.end()) continue;
+
+            std::vector<int>& bucket = it->second;
+            auto found = std::find(bucket.begin(), bucket.end(), id);
+            if (found != bucket.end()) {
+                *found = bucket.back();
+                bucket.pop_back();
+            }
+            if (bucket.empty()) {
+                cells.erase(it);
+            }
+        }
+    }
+    proxy.inGrid = false;
+}
+
+void PhysicsWorld::UpdateProxy(int id) {
+    Proxy& proxy = proxies[id];
+    BoxCollider2D* collider = proxy.collider;
+    GameObject* owner = collider->GetGameObject();
+
+    if (!collider->IsEnabled() || !owner || !owner->IsActive()) {
+        RemoveFromCells(id);
+        return;
+    }
+
+    proxy.aabb = collider->GetWorldAABB();
+
+    int minX = static_cast<int>(std::floor(proxy.aabb.Left() / cellSize));
+    int minY = static_cast<int>(std::floor(proxy.aabb.Top() / cellSize));
+    int maxX = static_cast<int>(std::floor(proxy.aabb.Right() / cellSize));
+    int maxY = static_cast<int>(std::floor(proxy.aabb.Bottom() / cellSize));
+
+    // Most colliders stay inside the same cells from frame to frame
+    if (proxy.inGrid && minX == proxy.minX && minY == proxy.minY &&
+        maxX == proxy.maxX && maxY == proxy.maxY) {
+        return;
+    }
+
+    RemoveFromCells(id);
+    proxy.minX = minX;
+    proxy.minY = minY;
+    proxy.maxX = maxX;
+    proxy.maxY = maxY;
+    InsertIntoCells(id);
+}
+
+void PhysicsWorld::FindPairs() {
+    pairTests = 0;
+
+    for (const auto& cell : cells) {
+        const std::vector<int>& bucket = cell.second;
+        if (bucket.size() < 2) continue;
+
+        int cellX = static_cast<int>(static_cast<uint32_t>(cell.first >> 32));
+        int cellY = static_cast<int>(static_cast<uint32_t>(cell.first & 0xffffffffu));
+
+        for (size_t i = 0; i < bucket.size(); i++) {
+            const Proxy& a = proxies[bucket[i]];
+            for (size_t j = i + 1; j < bucket.size(); j++) {
+                const Proxy& b = proxies[bucket[j]];
+
+                // A pair sharing several cells is only handled in the first
+                // shared cell (the top-left corner of the overlap)
+                if (std::max(a.minX, b.minX) != cellX || std::max(a.minY, b.minY) != cellY) {
+                    continue;
+                }
+                if (a.collider->GetGameObject() == b.collider->GetGameObject()) {
+                    continue;
+                }
+
+                pairTests++;
+                if (!Collision::CheckAABB(a.aabb, b.aabb)) continue;
+
+                bool isTrigger = a.collider->IsTrigger() || b.collider->IsTrigger();
+                uint64_t key = PairKey(bucket[i], bucket[j]);
+
+                auto it = contacts.find(key);
+                if (it == contacts.end()) {
+                    contacts.emplace(key, Contact{ a.collider, b.collider, isTrigger, stepCount });
+                    events.push_back({ EventType::Enter, isTrigger, a.collider, b.collider });
+                } else {
+                    it->second.lastStep = stepCount;
+                    events.push_back({ EventType::Stay, it->second.isTrigger, a.collider, b.collider });
+                }
+            }
+        }
+    }
+
+    for (auto it = contacts.begin(); it != contacts.end();) {
+        if (it->second.lastStep != stepCount) {
+            events.push_back({ EventType::Exit, it->second.isTrigger, it->second.a, it->second.b });
+            it = contacts.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PhysicsWorld::Step() {
+    MOLGA_PROFILE("PhysicsWorld::Step");
+
+    stepCount++;
+
+    for (int id = 0; id < static_cast<int>(proxies.size()); id++) {
+        if (proxies[id].collider) {
+            UpdateProxy(id);
+        }
+    }
+
+    events.clear();
+    FindPairs();
+
+    // Callbacks run after the broadphase is done so scripts may add or
+    // remove colliders safely
+    for (size_t i = 0; i < events.size(); i++) {
+        Event event = events[i];
+        if (!event.a || !event.b) continue;
+
+        GameObject* a = event.a->GetGameObject();
+        GameObject* b = event.b->GetGameObject();
+        DispatchToScripts(a, b, event);
+        DispatchToScripts(b, a, event);
+    }
+    events.clear();
+}
+
+void PhysicsWorld::DispatchToScripts(GameObject* self, GameObject* other, const Event& event) {
+    if (!self || !self->IsActive()) return;
+
+    for (const auto& comp : self->GetComponents()) {
+        if (!comp->IsEnabled()) continue;
+        Script* script = dynamic_cast<Script*>(comp);
+        if (!script) continue;
+
+        switch (event.type) {
+            case EventType::Enter:
+                if (event.isTrigger) script->OnTriggerEnter(other);
+                else script->OnCollisionEnter(other);
+                break;
+            case EventType::Stay:
+                if (event.isTrigger) script->OnTriggerStay(other);
+                else script->OnCollisionStay(other);
+                break;
+            case EventType::Exit:
+                if (event.isTrigger) script->OnTriggerExit(other);
+                else script->OnCollisionExit(other);
+                break;
+        }
+    }
+}
+
+void PhysicsWorld::QueryAABB(const AABB& box, std::vector<BoxCollider2D*>& out) {
+    int minX = static_cast<int>(std::floor(box.Left() / cellSize));
+    int minY = static_cast<int>(std::floor(box.Top() / cellSize));
+    int maxX = static_cast<int>(std::floor(box.Right() / cellSize));
+    int maxY = static_cast<int>(std::floor(box.Bottom() / cellSize));
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            auto it = cells.find(CellKey(x, y));
+            if (it == cells.end()) continue;
+
+            for (int id : it->second) {
+                const Proxy& proxy = proxies[id];
+                // Report each collider once: in the first queried cell it occupies
+                if (std::max(proxy.minX, minX) != x || std::max(proxy.minY, minY) != y) continue;
+                if (Collision::CheckAABB(box, proxy.aabb)) {
+                    out.push_back(proxy.collider);
+                }
+            }
+        }
+    }
+}
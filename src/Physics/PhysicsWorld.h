@@ -0,0 +1,111 @@
+#ifndef MOLGA_PHYSICS_WORLD_H
+#define MOLGA_PHYSICS_WORLD_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <utility>
+#include "../Common/Types.h"
+
+class BoxCollider2D;
+class GameObject;
+
+// Broadphase for BoxCollider2D components. Every enabled collider's world
+// AABB is kept in a uniform spatial hash that is updated incrementally (a
+// collider only moves between buckets when it crosses a cell boundary).
+// Step() finds overlapping pairs and calls the OnCollision*/OnTrigger*
+// hooks on Script components of both GameObjects.
+class PhysicsWorld {
+public:
+    static PhysicsWorld& Get();
+
+    // Called by BoxCollider2D::OnAttach/OnDetach
+    void Register(BoxCollider2D* collider);
+    void Unregister(BoxCollider2D* collider);
+
+    // Refresh the broadphase, update contacts and dispatch script callbacks
+    void Step();
+
+    // Colliders whose AABB overlaps the box
+    void QueryAABB(const AABB& box, std::vector<BoxCollider2D*>& out);
+
+    // Call fn(collider, aabb) for every collider in spatial hash cell (x, y),
+    // as of the last Step(). Colliders spanning several cells are visited
+    // once per cell.
+    template<typename F>
+    void ForEachInCell(int x, int y, F&& fn) const {
+        auto it = cells.find(CellKey(x, y));
+        if (it == cells.end()) return;
+        for (int id : it->second) {
+            fn(proxies[id].collider, proxies[id].aabb);
+        }
+    }
+    bool IsGridEmpty() const { return cells.empty(); }
+
+    // Cell size of the spatial hash in world units (rebuilds the grid)
+    void SetCellSize(float size);
+    float GetCellSize() const { return cellSize; }
+
+    // Drop all colliders and contacts without dispatching Exit callbacks
+    void Clear();
+
+    // Stats
+    int GetColliderCount() const { return static_cast<int>(proxies.size() - freeProxies.size()); }
+    int GetContactCount() const { return static_cast<int>(contacts.size()); }
+    int GetPairTestCount() const { return pairTests; }
+
+private:
+    PhysicsWorld() = default;
+    PhysicsWorld(const PhysicsWorld&) = delete;
+    PhysicsWorld& operator=(const PhysicsWorld&) = delete;
+
+    struct Proxy {
+        BoxCollider2D* collider = nullptr;
+        AABB aabb;
+        int minX = 0, minY = 0, maxX = -1, maxY = -1;  // Occupied cell range
+        bool inGrid = false;
+    };
+
+    struct Contact {
+        BoxCollider2D* a;
+        BoxCollider2D* b;
+        bool isTrigger;
+        unsigned int lastStep;  // Last Step() in which the pair overlapped
+    };
+
+    enum class EventType { Enter, Stay, Exit };
+
+    struct Event {
+        EventType type;
+        bool isTrigger;
+        BoxCollider2D* a;
+        BoxCollider2D* b;
+    };
+
+    static uint64_t CellKey(int x, int y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+    static uint64_t PairKey(int a, int b) {
+        if (a > b) std::swap(a, b);
+        return (static_cast<uint64_t>(static_cast<uint32_t>(a)) << 32) | static_cast<uint32_t>(b);
+    }
+
+    void UpdateProxy(int id);
+    void InsertIntoCells(int id);
+    void RemoveFromCells(int id);
+    void FindPairs();
+    void DispatchToScripts(GameObject* self, GameObject* other, const Event& event);
+
+    float cellSize = 64.0f;
+
+    std::vector<Proxy> proxies;
+    std::vector<int> freeProxies;
+    std::unordered_map<uint64_t, std::vector<int>> cells;
+    std::unordered_map<uint64_t, Contact> contacts;
+    std::vector<Event> events;
+
+    unsigned int stepCount = 0;
+    int pairTests = 0;
+};
+
+#endif // MOLGA_PHYSICS_WORLD_H
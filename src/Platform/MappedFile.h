@@ -0,0 +1,37 @@
+#ifndef MOLGA_MAPPED_FILE_H
+#define MOLGA_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Platform {
+
+// Read-only memory mapping of a whole file. The mapping is released when
+// the object is destroyed or Close() is called.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return data != nullptr; }
+    const void* GetData() const { return data; }
+    size_t GetSize() const { return size; }
+
+private:
+    const void* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+} // namespace Platform
+
+#endif // MOLGA_MAPPED_FILE_H
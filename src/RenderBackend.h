@@ -0,0 +1,28 @@
+#ifndef MOLGA_RENDER_BACKEND_H
+#define MOLGA_RENDER_BACKEND_H
+
+// Selects between the OpenGL backend and the null backend. With the null
+// backend nothing touches GL: Renderer draws nothing, shaders are not
+// compiled and a Texture only keeps its size, so simulation code runs
+// unchanged without a window or GL context.
+//
+// molga_runtime switches to it at startup with --headless. molga_server is
+// built with MOLGA_HEADLESS, where IsNull() is a constant and the GL
+// branches of the render sources compile away; it never loads GL.
+class RenderBackend {
+public:
+#ifdef MOLGA_HEADLESS
+    static constexpr bool IsNull() { return true; }
+    static void SetNull(bool) {}
+#else
+    static bool IsNull() { return nullBackend; }
+
+    // Must be chosen before any GL resource is created
+    static void SetNull(bool value) { nullBackend = value; }
+
+private:
+    static bool nullBackend;
+#endif
+};
+
+#endif // MOLGA_RENDER_BACKEND_H
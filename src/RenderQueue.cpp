@@ -0,0 +1,148 @@
+#include "RenderQueue.h"
+#include "Renderer.h"
+#include "Texture.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+RenderQueue& RenderQueue::Get() {
+    static RenderQueue instance;
+    return instance;
+}
+
+uint64_t RenderQueue::MakeKey(int layer, int sortingOrder, uint8_t shaderId, uint16_t textureId, uint16_t depth) {
+    layer = std::clamp(layer, 0, MAX_LAYER);
+    sortingOrder = std::clamp(sortingOrder, static_cast<int>(INT16_MIN), static_cast<int>(INT16_MAX));
+
+    // Biased so that negative orders sort below positive ones
+    uint64_t biasedOrder = static_cast<uint64_t>(sortingOrder + 32768);
+
+    return (static_cast<uint64_t>(layer) << 56) |
+           (biasedOrder << 40) |
+           (static_cast<uint64_t>(shaderId) << 32) |
+           (static_cast<uint64_t>(textureId) << 16) |
+           static_cast<uint64_t>(depth);
+}
+
+uint8_t RenderQueue::GetShaderId(Shader* shader) {
+    // 0 is the pass's shader. A frame uses a handful of shaders; past 255
+    // they share an id, which only costs batching.
+    if (!shader) return 0;
+
+    for (size_t i = 0; i < shaders.size(); i++) {
+        if (shaders[i] == shader) return static_cast<uint8_t>(std::min<size_t>(i + 1, 255));
+    }
+    shaders.push_back(shader);
+    return static_cast<uint8_t>(std::min<size_t>(shaders.size(), 255));
+}
+
+void RenderQueue::Submit(const Sprite& sprite, int layer, int sortingOrder, uint16_t depth, Shader* shader) {
+    // Texture ids only group sprites; two textures sharing the low bits
+    // still draw correctly
+    uint16_t textureId = sprite.texture ? static_cast<uint16_t>(sprite.texture->GetID()) : 0;
+    uint64_t key = MakeKey(layer, sortingOrder, GetShaderId(shader), textureId, depth);
+
+    order.push_back({ key, static_cast<uint32_t>(commands.size()) });
+    commands.push_back({ sprite, shader });
+}
+
+void RenderQueue::Sort() {
+    MOLGA_PROFILE("RenderQueue::Sort");
+
+    size_t count = order.size();
+    if (count < 2) return;
+
+    // Histograms of all eight key bytes in one read of the keys
+    uint32_t histograms[8][256];
+    std::memset(histograms, 0, sizeof(histograms));
+    for (const SortEntry& entry : order) {
+        uint64_t key = entry.key;
+        for (int byte = 0; byte < 8; byte++) {
+            histograms[byte][(key >> (byte * 8)) & 0xFF]++;
+        }
+    }
+
+    scratch.resize(count);
+    SortEntry* source = order.data();
+    SortEntry* target = scratch.data();
+
+    for (int byte = 0; byte < 8; byte++) {
+        int shift = byte * 8;
+        uint32_t* histogram = histograms[byte];
+
+        // Every key has the same value in this byte: the pass would not
+        // move anything. Common for layer, shader and depth.
+        if (histogram[(source[0].key >> shift) & 0xFF] == count) continue;
+
+        uint32_t offset = 0;
+        for (int value = 0; value < 256; value++) {
+            uint32_t bucket = histogram[value];
+            histogram[value] = offset;
+            offset += bucket;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            target[histogram[(source[i].key >> shift) & 0xFF]++] = source[i];
+        }
+        std::swap(source, target);
+    }
+
+    // An odd number of passes left the result in scratch
+    if (source != order.data()) {
+        order.swap(scratch);
+    }
+}
+
+void RenderQueue::Flush(Renderer* renderer, Shader* shader, Camera2D* camera) {
+    MOLGA_PROFILE("RenderQueue::Flush");
+
+    Sort();
+
+    bool ownPass = !renderer->IsDrawing();
+    if (ownPass) {
+        renderer->Begin(shader, camera);
+    }
+
+    // Per-sprite shaders need a batch to switch programs in
+    SpriteBatch* batch = renderer->IsBatching() ? &renderer->GetSpriteBatch() : nullptr;
+    Shader* passShader = batch ? batch->GetShader() : nullptr;
+    Shader* currentShader = passShader;
+    Texture* currentTexture = nullptr;
+
+    stateChanges = 0;
+    for (const SortEntry& entry : order) {
+        Command& command = commands[entry.index];
+
+        if (batch) {
+            Shader* wanted = command.shader ? command.shader : passShader;
+            if (wanted != currentShader) {
+                batch->SetShader(wanted);
+                currentShader = wanted;
+                stateChanges++;
+            }
+        }
+        if (command.sprite.texture != currentTexture) {
+            currentTexture = command.sprite.texture;
+            stateChanges++;
+        }
+
+        renderer->DrawSprite(&command.sprite);
+    }
+
+    if (batch && currentShader != passShader) {
+        batch->SetShader(passShader);
+    }
+    if (ownPass) {
+        renderer->End();
+    }
+
+    flushedSprites = static_cast<int>(commands.size());
+    Clear();
+}
+
+void RenderQueue::Clear() {
+    commands.clear();
+    order.clear();
+    shaders.clear();
+}
@@ -0,0 +1,86 @@
+#ifndef MOLGA_RENDER_QUEUE_H
+#define MOLGA_RENDER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Sprite.h"
+
+class Renderer;
+class Shader;
+class Camera2D;
+
+// Sprites submitted for a frame, drawn in the order of a packed 64-bit
+// key. From the most significant bits down:
+//
+//   layer (8) | sortingOrder (16) | shader (8) | texture (16) | depth (16)
+//
+// so layering is decided first, and sprites on the same layer and sorting
+// order are grouped by shader and texture, which keeps SpriteBatch batches
+// as long as possible. Sprites with equal keys keep their submission order.
+//
+// Keys are sorted with an LSD radix sort (8 bits per pass; passes over a
+// byte every key shares are skipped), linear in the number of sprites.
+//
+//   for (each visible sprite) RenderQueue::Get().Submit(sprite, layer, order);
+//   RenderQueue::Get().Flush(renderer, shader, camera);
+class RenderQueue {
+public:
+    static RenderQueue& Get();
+
+    static constexpr int MAX_LAYER = 255;
+
+    // Clamps layer to [0, MAX_LAYER] and sortingOrder to the int16_t range
+    static uint64_t MakeKey(int layer, int sortingOrder, uint8_t shaderId, uint16_t textureId, uint16_t depth);
+
+    // Queue a copy of sprite. shader nullptr draws with the pass's shader;
+    // other shaders are only switched to when the renderer is batching.
+    void Submit(const Sprite& sprite, int layer, int sortingOrder, uint16_t depth = 0, Shader* shader = nullptr);
+
+    // Sort and draw everything submitted, then empty the queue. Draws into
+    // the renderer's pass if one is open, else in a pass of its own.
+    void Flush(Renderer* renderer, Shader* shader, Camera2D* camera);
+
+    // Order the queue by key (Flush does this)
+    void Sort();
+
+    // Drop submissions without drawing them
+    void Clear();
+
+    size_t GetCount() const { return commands.size(); }
+
+    // Submission index of the i-th sprite in draw order (after Sort)
+    uint32_t GetSortedIndex(size_t i) const { return order[i].index; }
+    uint64_t GetSortedKey(size_t i) const { return order[i].key; }
+
+    // Stats of the last Flush
+    int GetSpriteCount() const { return flushedSprites; }
+    int GetStateChanges() const { return stateChanges; }    // Shader and texture switches
+
+private:
+    RenderQueue() = default;
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    struct Command {
+        Sprite sprite;
+        Shader* shader;
+    };
+
+    struct SortEntry {
+        uint64_t key;
+        uint32_t index;     // Into commands
+    };
+
+    uint8_t GetShaderId(Shader* shader);
+
+    std::vector<Command> commands;
+    std::vector<SortEntry> order;
+    std::vector<SortEntry> scratch;         // Radix sort ping-pong buffer
+    std::vector<Shader*> shaders;           // Shader ids handed out since the last Flush
+
+    int flushedSprites = 0;
+    int stateChanges = 0;
+};
+
+#endif // MOLGA_RENDER_QUEUE_H
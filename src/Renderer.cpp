@@ -3,8 +3,17 @@
 #include "Sprite.h"
 #include "Texture.h"
 #include "Camera2D.h"
+#include "FrameUniforms.h"
+#include "RenderBackend.h"
+#include "Core/Profiler.h"
+#include "Core/JobSystem.h"
 
-Renderer::Renderer() : VAO(0), VBO(0), EBO(0), currentShader(nullptr) {
+#ifndef MOLGA_HEADLESS
+bool RenderBackend::nullBackend = false;
+#endif
+
+Renderer::Renderer() : VAO(0), VBO(0), EBO(0), currentShader(nullptr), batchShader(nullptr), batchReplaces(nullptr),
+      particleShader(nullptr), uniformShader(nullptr), gpuZoneOpen(false) {
     mat4x4_identity(projection);
     mat4x4_identity(view);
 }
@@ -13,10 +22,15 @@ Renderer::~Renderer() {
     if (VAO) glDeleteVertexArrays(1, &VAO);
     if (VBO) glDeleteBuffers(1, &VBO);
     if (EBO) glDeleteBuffers(1, &EBO);
+    FrameUniforms::Shutdown();
 }
 
 void Renderer::Init() {
+    if (RenderBackend::IsNull()) return;
+
     SetupQuadBuffers();
+    batch.Init();
+    FrameUniforms::Init();
 }
 
 void Renderer::SetupQuadBuffers() {
@@ -53,11 +67,13 @@ void Renderer::SetupQuadBuffers() {
 }
 
 void Renderer::Clear(float r, float g, float b, float a) {
+    if (RenderBackend::IsNull()) return;
     glClearColor(r, g, b, a);
     glClear(GL_COLOR_BUFFER_BIT);
 }
 
 void Renderer::SetViewport(int width, int height) {
+    if (RenderBackend::IsNull()) return;
     glViewport(0, 0, width, height);
 }
 
@@ -65,10 +81,7 @@ void Renderer::SetProjection(float left, float right, float bottom, float top) {
     mat4x4_ortho(projection, left, right, bottom, top, -1.0f, 1.0f);
 }
 
-void Renderer::Begin(Shader* shader, Camera2D* camera) {
-    currentShader = shader;
-    currentShader->Use();
-
+void Renderer::GetProjectionView(Camera2D* camera, mat4x4 out) {
     if (camera) {
         camera->GetProjectionMatrix(projection);
         camera->GetViewMatrix(view);
@@ -77,27 +90,67 @@ void Renderer::Begin(Shader* shader, Camera2D* camera) {
     }
 
     // Combine projection and view into one matrix
+    mat4x4_mul(out, projection, view);
+}
+
+void Renderer::Begin(Shader* shader, Camera2D* camera) {
+    // Leaves currentShader null, so DrawSprite and End do nothing
+    if (RenderBackend::IsNull()) return;
+    MOLGA_ASSERT_MAIN_THREAD("Renderer::Begin");
+
+#ifdef MOLGA_PROFILING
+    if (!gpuZoneOpen && Profiler::IsEnabled()) {
+        gpuZoneOpen = Profiler::Get().BeginGpuZone("Renderer");
+    }
+#endif
+
     mat4x4 projView;
-    mat4x4_mul(projView, projection, view);
-    currentShader->SetMat4("projection", (float*)projView);
+    GetProjectionView(camera, projView);
+
+    if (batchShader && (!shader || shader == batchShader || shader == batchReplaces)) {
+        currentShader = batchShader;
+        batch.Begin(batchShader, (float*)projView);
+        return;
+    }
+    if (!shader) return;
+
+    currentShader = shader;
+    currentShader->Use();
+    FrameUniforms::SetProjection((float*)projView);
+
+    // Resolve the per-sprite uniforms once per shader
+    if (uniformShader != shader || uniformRevision != shader->GetRevision()) {
+        uniformShader = shader;
+        uniformRevision = shader->GetRevision();
+        uModel = shader->GetUniform<mat4x4>("model");
+        uColor = shader->GetUniform<vec4>("uColor");
+        uUV = shader->GetUniform<vec4>("uUV");
+        uUseTexture = shader->GetUniform<bool>("useTexture");
+        uTexture = shader->GetUniform<int>("uTexture");
+    }
 }
 
 void Renderer::DrawSprite(Sprite* sprite) {
     if (!currentShader || !sprite) return;
 
+    if (batch.IsDrawing()) {
+        batch.Draw(*sprite);
+        return;
+    }
+
     mat4x4 model;
     sprite->GetModelMatrix(model);
 
-    currentShader->SetMat4("model", (float*)model);
-    currentShader->SetVec4("uColor", sprite->color[0], sprite->color[1], sprite->color[2], sprite->color[3]);
-    currentShader->SetVec4("uUV", sprite->uv[0], sprite->uv[1], sprite->uv[2], sprite->uv[3]);
+    currentShader->Set(uModel, model);
+    currentShader->Set(uColor, sprite->color);
+    currentShader->Set(uUV, sprite->uv);
 
     if (sprite->texture) {
-        currentShader->SetBool("useTexture", true);
-        currentShader->SetInt("uTexture", 0);
+        currentShader->Set(uUseTexture, true);
+        currentShader->Set(uTexture, 0);
         sprite->texture->Bind(0);
     } else {
-        currentShader->SetBool("useTexture", false);
+        currentShader->Set(uUseTexture, false);
     }
 
     glBindVertexArray(VAO);
@@ -106,5 +159,11 @@ void Renderer::DrawSprite(Sprite* sprite) {
 }
 
 void Renderer::End() {
+    batch.End();
     currentShader = nullptr;
+
+    if (gpuZoneOpen) {
+        Profiler::Get().EndGpuZone();
+        gpuZoneOpen = false;
+    }
 }
@@ -3,8 +3,9 @@
 
 #include <glad/glad.h>
 #include "linmath.h"
+#include "SpriteBatch.h"
+#include "Shader.h"
 
-class Shader;
 class Sprite;
 class Camera2D;
 
@@ -23,14 +24,53 @@ public:
 
     void SetProjection(float left, float right, float bottom, float top);
 
+    // Batched sprite mode: when a batch shader is set, DrawSprite calls between
+    // Begin/End are collected into a SpriteBatch instead of drawn one by one.
+    // The batch stands in for spriteShader, the per-sprite program it mirrors:
+    // Begin with that shader, the batch shader or null batches; any other
+    // shader is drawn unbatched with that program.
+    void SetBatchShader(Shader* shader, Shader* spriteShader = nullptr) {
+        batchShader = shader;
+        batchReplaces = spriteShader;
+    }
+    Shader* GetBatchShader() const { return batchShader; }
+    bool IsBatching() const { return batch.IsDrawing(); }
+    bool IsDrawing() const { return currentShader != nullptr; }
+    SpriteBatch& GetSpriteBatch() { return batch; }
+
+    // Instanced particle mode: when set, ParticleEmitter::Render draws all
+    // live particles of an emitter with a single instanced draw call
+    void SetParticleShader(Shader* shader) { particleShader = shader; }
+    Shader* GetParticleShader() const { return particleShader; }
+
+    // Combined projection * view for the given camera (identity view if null)
+    void GetProjectionView(Camera2D* camera, mat4x4 out);
+
 private:
     unsigned int VAO;
     unsigned int VBO;
     unsigned int EBO;
     Shader* currentShader;
+    Shader* batchShader;
+    Shader* batchReplaces;
+    Shader* particleShader;
+    SpriteBatch batch;
     mat4x4 projection;
     mat4x4 view;
 
+    // Uniform handles for the unbatched path, valid for uniformShader at
+    // uniformRevision (a reload relinks the program)
+    const Shader* uniformShader;
+    unsigned int uniformRevision = 0;
+    Shader::Uniform<mat4x4> uModel;
+    Shader::Uniform<vec4> uColor;
+    Shader::Uniform<vec4> uUV;
+    Shader::Uniform<bool> uUseTexture;
+    Shader::Uniform<int> uTexture;
+
+    // GPU profiler zone spanning Begin..End
+    bool gpuZoneOpen;
+
     void SetupQuadBuffers();
 };
 
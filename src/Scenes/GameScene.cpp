@@ -143,8 +143,8 @@ void GameScene::Update(float dt) {
     }
 
     // Update particles
-    fireEmitter.Update(dt);
-    sparkEmitter.Update(dt);
+    ParticleEmitter* emitters[] = { &fireEmitter, &sparkEmitter };
+    ParticleEmitter::UpdateAll(emitters, 2, dt);
 
     uiManager.Update(dt);
 }
@@ -157,24 +157,23 @@ void GameScene::UpdatePlayer(float dt) {
     if (Input::GetKey(GLFW_KEY_A) || Input::GetKey(GLFW_KEY_LEFT))  dx -= 1.0f;
     if (Input::GetKey(GLFW_KEY_D) || Input::GetKey(GLFW_KEY_RIGHT)) dx += 1.0f;
 
-    // Move and resolve collision
-    playerSprite.x += dx * moveSpeed * dt;
-    std::vector<AABB> collidingTiles = tilemap->GetCollidingTiles(playerSprite.GetAABB());
-    for (const AABB& tile : collidingTiles) {
-        CollisionResult result = Collision::CheckAABBWithResult(playerSprite.GetAABB(), tile);
-        if (result.collided) {
-            playerSprite.x -= result.overlapX;
-        }
-    }
-
-    playerSprite.y += dy * moveSpeed * dt;
-    collidingTiles = tilemap->GetCollidingTiles(playerSprite.GetAABB());
-    for (const AABB& tile : collidingTiles) {
-        CollisionResult result = Collision::CheckAABBWithResult(playerSprite.GetAABB(), tile);
-        if (result.collided) {
-            playerSprite.y -= result.overlapY;
-        }
+    // Sweep against the tiles and slide along whatever is hit. Two passes
+    // cover running into a corner.
+    Vector2 move(dx * moveSpeed * dt, dy * moveSpeed * dt);
+    AABB box = playerSprite.GetAABB();
+    for (int pass = 0; pass < 2 && (move.x != 0.0f || move.y != 0.0f); pass++) {
+        TileSweepResult sweep = tilemap->SweepAABB(box, move);
+        box.x += move.x * sweep.time;
+        box.y += move.y * sweep.time;
+        if (!sweep.hit) break;
+
+        // Keep the remaining motion along the surface
+        float remaining = 1.0f - sweep.time;
+        move.x = sweep.normalX != 0.0f ? 0.0f : move.x * remaining;
+        move.y = sweep.normalY != 0.0f ? 0.0f : move.y * remaining;
     }
+    playerSprite.x = box.x;
+    playerSprite.y = box.y;
 
     // Sync GameObject position with sprite
     if (playerObject) {
@@ -4,7 +4,7 @@
 #include "../Camera2D.h"
 #include "../Input.h"
 #include "../Sprite.h"
-#include "../TextRenderer.h"
+#include "../TextMesh.h"
 #include "../ECS/Components/Transform.h"
 #include "../ECS/Components/SpriteRenderer.h"
 #include <GLFW/glfw3.h>
@@ -161,33 +161,16 @@ void MenuScene::Render(Renderer* renderer, Shader* shader, Camera2D* camera) {
 
     renderer->End();
 
-    // Render text labels
-    TextRenderer& textRenderer = TextRenderer::Get();
-
-    // Title text - centered on title background
-    float titleScale = 4.0f;
-    std::string titleText = "MOLGA ENGINE";
-    float titleWidth = textRenderer.GetTextWidth(titleText, titleScale);
-    float titleX = screenWidth / 2.0f - titleWidth / 2.0f;
-    textRenderer.RenderText(renderer, shader, titleText, titleX, 165.0f, titleScale, Color::White());
-
-    // Start button text - centered on button
-    float buttonScale = 3.0f;
-    std::string startText = "Start";
-    float startWidth = textRenderer.GetTextWidth(startText, buttonScale);
-    float startX = screenWidth / 2.0f - startWidth / 2.0f;
-    textRenderer.RenderText(renderer, shader, startText, startX, 312.0f, buttonScale, Color::White());
-
-    // Quit button text - centered on button
-    std::string quitText = "Quit";
-    float quitWidth = textRenderer.GetTextWidth(quitText, buttonScale);
-    float quitX = screenWidth / 2.0f - quitWidth / 2.0f;
-    textRenderer.RenderText(renderer, shader, quitText, quitX, 382.0f, buttonScale, Color::White());
-
-    // Instructions text
-    float instrScale = 2.0f;
-    std::string instrText = "Press ENTER or SPACE to start";
-    float instrWidth = textRenderer.GetTextWidth(instrText, instrScale);
-    float instrX = screenWidth / 2.0f - instrWidth / 2.0f;
-    textRenderer.RenderText(renderer, shader, instrText, instrX, 500.0f, instrScale, Color(0.7f, 0.7f, 0.7f, 1.0f));
+    // Text labels: retained meshes (laid out once) drawn in a single batch
+    titleLabel.SetText("MOLGA ENGINE", 4.0f);
+    startLabel.SetText("Start", 3.0f);
+    quitLabel.SetText("Quit", 3.0f);
+    instructionsLabel.SetText("Press ENTER or SPACE to start", 2.0f, Color(0.7f, 0.7f, 0.7f, 1.0f));
+
+    renderer->Begin(shader, nullptr);
+    titleLabel.Draw(renderer, screenWidth / 2.0f - titleLabel.GetWidth() / 2.0f, 165.0f);
+    startLabel.Draw(renderer, screenWidth / 2.0f - startLabel.GetWidth() / 2.0f, 312.0f);
+    quitLabel.Draw(renderer, screenWidth / 2.0f - quitLabel.GetWidth() / 2.0f, 382.0f);
+    instructionsLabel.Draw(renderer, screenWidth / 2.0f - instructionsLabel.GetWidth() / 2.0f, 500.0f);
+    renderer->End();
 }
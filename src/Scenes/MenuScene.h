@@ -3,6 +3,7 @@
 
 #include "../Scene.h"
 #include "../ECS/GameObject.h"
+#include "../TextMesh.h"
 #include <vector>
 #include <memory>
 
@@ -37,6 +38,12 @@ private:
     bool startHovered = false;
     bool quitHovered = false;
     int selectedButton = 0;  // 0 = Start, 1 = Quit (for keyboard navigation)
+
+    // Labels
+    TextMesh titleLabel;
+    TextMesh startLabel;
+    TextMesh quitLabel;
+    TextMesh instructionsLabel;
 };
 
 #endif // MOLGA_MENU_SCENE_H
@@ -24,10 +24,10 @@ public:
     virtual void Update(float deltaTime) override {}
 
     // Called at fixed intervals (for physics)
-    virtual void FixedUpdate(float fixedDeltaTime) {}
+    void FixedUpdate(float fixedDeltaTime) override {}
 
     // Called after all Update calls
-    virtual void LateUpdate(float deltaTime) {}
+    void LateUpdate(float deltaTime) override {}
 
     // Called when the script is enabled
     virtual void OnEnable() {}
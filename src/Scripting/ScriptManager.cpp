@@ -1,6 +1,7 @@
 #include "ScriptManager.h"
 #include "Script.h"
 #include "../Platform/Platform.h"
+#include "../Core/Profiler.h"
 #include <iostream>
 #include <algorithm>
 
@@ -37,6 +38,8 @@ bool ScriptManager::IsScriptRegistered(const std::string& name) const {
 }
 
 bool ScriptManager::LoadScriptLibrary(const std::string& path) {
+    MOLGA_PROFILE("ScriptManager::LoadScriptLibrary");
+
     // Check if already loaded
     if (libraryHandles.find(path) != libraryHandles.end()) {
         std::cout << "[ScriptManager] Library already loaded: " << path << std::endl;
@@ -1,59 +1,243 @@
 #include "Shader.h"
+#include "FrameUniforms.h"
+#include "RenderBackend.h"
+#include "Core/JobSystem.h"
+#include "Common/PathUtil.h"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 
-Shader::Shader(const char* vertexPath, const char* fragmentPath) {
-    std::string vertexSource = LoadShaderSource(vertexPath);
-    std::string fragmentSource = LoadShaderSource(fragmentPath);
+namespace {
 
-    unsigned int vertexShader = CompileShader(vertexSource.c_str(), GL_VERTEX_SHADER);
-    unsigned int fragmentShader = CompileShader(fragmentSource.c_str(), GL_FRAGMENT_SHADER);
+// Live shaders, for ReloadFile
+std::vector<Shader*>& LiveShaders() {
+    static std::vector<Shader*> shaders;
+    return shaders;
+}
+
+} // namespace
+
+Shader::Shader(const char* vertexPath, const char* fragmentPath)
+    : programID(0), vertexPath(vertexPath), fragmentPath(fragmentPath) {
+    // No program; every uniform lookup returns -1 and is ignored
+    if (RenderBackend::IsNull()) return;
+    MOLGA_ASSERT_MAIN_THREAD("Shader::Shader");
 
-    programID = glCreateProgram();
-    glAttachShader(programID, vertexShader);
-    glAttachShader(programID, fragmentShader);
-    glLinkProgram(programID);
-    CheckCompileErrors(programID, "PROGRAM");
+    vertexFile = PathUtil::Normalize(this->vertexPath);
+    fragmentFile = PathUtil::Normalize(this->fragmentPath);
+    LiveShaders().push_back(this);
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    programID = BuildProgram();
+    if (programID) {
+        ReflectUniforms();
+    }
 }
 
 Shader::~Shader() {
+    auto& shaders = LiveShaders();
+    shaders.erase(std::remove(shaders.begin(), shaders.end(), this), shaders.end());
+
+    if (!programID) return;
     glDeleteProgram(programID);
 }
 
+unsigned int Shader::BuildProgram() {
+    std::string vertexSource = LoadShaderSource(vertexPath.c_str());
+    std::string fragmentSource = LoadShaderSource(fragmentPath.c_str());
+
+    unsigned int vertexShader = CompileShader(vertexSource.c_str(), GL_VERTEX_SHADER);
+    unsigned int fragmentShader = CompileShader(fragmentSource.c_str(), GL_FRAGMENT_SHADER);
+
+    unsigned int program = 0;
+    if (vertexShader && fragmentShader) {
+        program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+        if (!CheckCompileErrors(program, "PROGRAM")) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    if (vertexShader) glDeleteShader(vertexShader);
+    if (fragmentShader) glDeleteShader(fragmentShader);
+    return program;
+}
+
+bool Shader::Reload() {
+    if (RenderBackend::IsNull()) return false;
+    MOLGA_ASSERT_MAIN_THREAD("Shader::Reload");
+
+    unsigned int program = BuildProgram();
+    if (!program) {
+        std::cerr << "[Shader] Reload failed, keeping the previous program: "
+                  << vertexPath << ", " << fragmentPath << std::endl;
+        return false;
+    }
+
+    if (programID) {
+        glDeleteProgram(programID);
+    }
+    programID = program;
+    revision++;
+
+    // New locations, and the new program has none of the cached values
+    ReflectUniforms();
+
+    std::cout << "[Shader] Reloaded: " << vertexPath << ", " << fragmentPath << std::endl;
+    return true;
+}
+
+bool Shader::UsesFile(const std::string& path) const {
+    std::string file = PathUtil::Normalize(path);
+    return file == vertexFile || file == fragmentFile;
+}
+
+int Shader::ReloadFile(const std::string& path) {
+    int reloaded = 0;
+    for (Shader* shader : LiveShaders()) {
+        if (shader->UsesFile(path) && shader->Reload()) reloaded++;
+    }
+    return reloaded;
+}
+
 void Shader::Use() const {
+    if (!programID) return;
     glUseProgram(programID);
 }
 
+void Shader::ReflectUniforms() {
+    uniformLocations.clear();
+    uniformCache.clear();
+
+    int count = 0;
+    glGetProgramiv(programID, GL_ACTIVE_UNIFORMS, &count);
+
+    char name[256];
+    for (int i = 0; i < count; i++) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(programID, static_cast<GLuint>(i), sizeof(name), &length, &size, &type, name);
+
+        // Members of uniform blocks have no location
+        int location = glGetUniformLocation(programID, name);
+        if (location < 0) continue;
+
+        // Arrays are reported as "name[0]"; make them reachable as "name" too
+        std::string uniformName(name, length);
+        size_t bracket = uniformName.find('[');
+        if (bracket != std::string::npos) {
+            uniformLocations[uniformName.substr(0, bracket)] = location;
+        }
+        uniformLocations[uniformName] = location;
+
+        if (location >= static_cast<int>(uniformCache.size())) {
+            uniformCache.resize(location + 1);
+        }
+    }
+
+    // Per-frame data shared across programs
+    GLuint blockIndex = glGetUniformBlockIndex(programID, FrameUniforms::BLOCK_NAME);
+    if (blockIndex != GL_INVALID_INDEX) {
+        glUniformBlockBinding(programID, blockIndex, FrameUniforms::BINDING);
+    }
+}
+
+int Shader::GetUniformLocation(const char* name) const {
+    auto it = uniformLocations.find(name);
+    return it != uniformLocations.end() ? it->second : -1;
+}
+
+bool Shader::UpdateCache(int location, const void* value, size_t size) const {
+    if (location < 0) return false;
+
+    if (location >= static_cast<int>(uniformCache.size())) {
+        uniformCache.resize(location + 1);
+    }
+
+    CachedValue& cached = uniformCache[location];
+    if (cached.valid && std::memcmp(cached.data, value, size) == 0) {
+        return false;
+    }
+
+    std::memcpy(cached.data, value, size);
+    cached.valid = true;
+    return true;
+}
+
+void Shader::Upload(int location, int value) const {
+    if (UpdateCache(location, &value, sizeof(value))) {
+        glUniform1i(location, value);
+    }
+}
+
+void Shader::Upload(int location, bool value) const {
+    Upload(location, static_cast<int>(value));
+}
+
+void Shader::Upload(int location, float value) const {
+    if (UpdateCache(location, &value, sizeof(value))) {
+        glUniform1f(location, value);
+    }
+}
+
+void Shader::Upload(int location, const vec2& value) const {
+    if (UpdateCache(location, value, sizeof(vec2))) {
+        glUniform2fv(location, 1, value);
+    }
+}
+
+void Shader::Upload(int location, const vec3& value) const {
+    if (UpdateCache(location, value, sizeof(vec3))) {
+        glUniform3fv(location, 1, value);
+    }
+}
+
+void Shader::Upload(int location, const vec4& value) const {
+    if (UpdateCache(location, value, sizeof(vec4))) {
+        glUniform4fv(location, 1, value);
+    }
+}
+
+void Shader::Upload(int location, const mat4x4& value) const {
+    if (UpdateCache(location, value, sizeof(mat4x4))) {
+        glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
+    }
+}
+
 void Shader::SetInt(const char* name, int value) const {
-    glUniform1i(glGetUniformLocation(programID, name), value);
+    Upload(GetUniformLocation(name), value);
 }
 
 void Shader::SetFloat(const char* name, float value) const {
-    glUniform1f(glGetUniformLocation(programID, name), value);
+    Upload(GetUniformLocation(name), value);
 }
 
 void Shader::SetVec2(const char* name, float x, float y) const {
-    glUniform2f(glGetUniformLocation(programID, name), x, y);
+    vec2 value = { x, y };
+    Upload(GetUniformLocation(name), value);
 }
 
 void Shader::SetVec3(const char* name, float x, float y, float z) const {
-    glUniform3f(glGetUniformLocation(programID, name), x, y, z);
+    vec3 value = { x, y, z };
+    Upload(GetUniformLocation(name), value);
 }
 
 void Shader::SetVec4(const char* name, float x, float y, float z, float w) const {
-    glUniform4f(glGetUniformLocation(programID, name), x, y, z, w);
+    vec4 value = { x, y, z, w };
+    Upload(GetUniformLocation(name), value);
 }
 
 void Shader::SetMat4(const char* name, const float* matrix) const {
-    glUniformMatrix4fv(glGetUniformLocation(programID, name), 1, GL_FALSE, matrix);
+    Upload(GetUniformLocation(name), *reinterpret_cast<const mat4x4*>(matrix));
 }
 
 void Shader::SetBool(const char* name, bool value) const {
-    glUniform1i(glGetUniformLocation(programID, name), static_cast<int>(value));
+    Upload(GetUniformLocation(name), value);
 }
 
 std::string Shader::LoadShaderSource(const char* path) {
@@ -74,12 +258,15 @@ unsigned int Shader::CompileShader(const char* source, GLenum type) {
     glCompileShader(shader);
 
     std::string typeName = (type == GL_VERTEX_SHADER) ? "VERTEX" : "FRAGMENT";
-    CheckCompileErrors(shader, typeName);
+    if (!CheckCompileErrors(shader, typeName)) {
+        glDeleteShader(shader);
+        return 0;
+    }
 
     return shader;
 }
 
-void Shader::CheckCompileErrors(unsigned int shader, const std::string& type) {
+bool Shader::CheckCompileErrors(unsigned int shader, const std::string& type) {
     int success;
     char infoLog[1024];
 
@@ -96,4 +283,5 @@ void Shader::CheckCompileErrors(unsigned int shader, const std::string& type) {
             std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
         }
     }
+    return success != 0;
 }
@@ -3,6 +3,9 @@
 
 #include <glad/glad.h>
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include "linmath.h"
 
 class Shader {
 public:
@@ -11,6 +14,31 @@ public:
 
     void Use() const;
 
+    // Typed handle to a uniform location, resolved once and reused:
+    //   auto uModel = shader->GetUniform<mat4x4>("model");
+    //   shader->Set(uModel, model);
+    // Supported types: int, bool, float, vec2, vec3, vec4, mat4x4.
+    template<typename T>
+    struct Uniform {
+        int location = -1;
+        bool IsValid() const { return location >= 0; }
+    };
+
+    template<typename T>
+    Uniform<T> GetUniform(const char* name) const {
+        Uniform<T> uniform;
+        uniform.location = GetUniformLocation(name);
+        return uniform;
+    }
+
+    // The shader must be bound (Use) before setting values. Values equal to
+    // the last one uploaded for the same location are not re-sent.
+    template<typename T>
+    void Set(const Uniform<T>& uniform, const T& value) const {
+        Upload(uniform.location, value);
+    }
+
+    // By-name setters (location comes from the table built at link time)
     void SetInt(const char* name, int value) const;
     void SetFloat(const char* name, float value) const;
     void SetVec2(const char* name, float x, float y) const;
@@ -19,14 +47,63 @@ public:
     void SetMat4(const char* name, const float* matrix) const;
     void SetBool(const char* name, bool value) const;
 
+    // -1 if the program has no active uniform with this name
+    int GetUniformLocation(const char* name) const;
+
     unsigned int GetID() const { return programID; }
 
+    // Recompile and relink from the source files. On a compile or link
+    // error the current program is kept and false is returned. Uniform
+    // locations may move: handles from GetUniform must be resolved again
+    // once GetRevision() changes.
+    bool Reload();
+    unsigned int GetRevision() const { return revision; }
+
+    // True if the program is built from this file
+    bool UsesFile(const std::string& path) const;
+
+    // Reload every live shader built from path (after it changed on disk).
+    // Returns how many were reloaded.
+    static int ReloadFile(const std::string& path);
+
 private:
     unsigned int programID;
+    unsigned int revision = 0;
+
+    // Source files as given, and normalized for UsesFile
+    std::string vertexPath;
+    std::string fragmentPath;
+    std::string vertexFile;
+    std::string fragmentFile;
+
+    // Active uniforms, reflected after linking
+    std::unordered_map<std::string, int> uniformLocations;
+
+    // Last value uploaded per location, used to skip redundant uploads
+    struct CachedValue {
+        float data[16];
+        bool valid = false;
+    };
+    mutable std::vector<CachedValue> uniformCache;
 
     std::string LoadShaderSource(const char* path);
     unsigned int CompileShader(const char* source, GLenum type);
-    void CheckCompileErrors(unsigned int shader, const std::string& type);
+    bool CheckCompileErrors(unsigned int shader, const std::string& type);
+
+    // Compile and link the source files; 0 on failure
+    unsigned int BuildProgram();
+    void ReflectUniforms();
+
+    // True if the value differs from the cached one (and updates the cache)
+    bool UpdateCache(int location, const void* value, size_t size) const;
+
+    void Upload(int location, int value) const;
+    void Upload(int location, bool value) const;
+    void Upload(int location, float value) const;
+    void Upload(int location, const vec2& value) const;
+    void Upload(int location, const vec3& value) const;
+    void Upload(int location, const vec4& value) const;
+    void Upload(int location, const mat4x4& value) const;
 };
 
 #endif // MOLGA_SHADER_H
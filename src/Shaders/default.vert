@@ -5,7 +5,11 @@ layout (location = 1) in vec2 aTexCoord;
 out vec2 TexCoord;
 
 uniform mat4 model;
-uniform mat4 projection;
+// Per-frame data shared by all programs (FrameUniforms.h)
+layout (std140) uniform FrameData {
+    mat4 projection;  // projection * view
+    float time;
+};
 uniform vec4 uUV;  // u0, v0, u1, v1
 
 void main() {
@@ -0,0 +1,24 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;       // Unit quad corner, centered on origin
+layout (location = 1) in vec4 aInstance;  // x, y, size, rotation (degrees)
+layout (location = 2) in vec4 aColor;
+
+out vec4 Color;
+
+// Per-frame data shared by all programs (FrameUniforms.h)
+layout (std140) uniform FrameData {
+    mat4 projection;  // projection * view
+    float time;
+};
+
+void main() {
+    float angle = radians(aInstance.w);
+    float c = cos(angle);
+    float s = sin(angle);
+
+    vec2 local = aPos * aInstance.z;
+    vec2 world = vec2(local.x * c - local.y * s, local.x * s + local.y * c) + aInstance.xy;
+
+    gl_Position = projection * vec4(world, 0.0, 1.0);
+    Color = aColor;
+}
@@ -0,0 +1,16 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoord;
+in vec4 Color;
+
+uniform sampler2D uTexture;
+
+void main() {
+    // Signed distance field glyphs (Font): 0.5 is the outline. Smoothing
+    // over one screen pixel keeps edges crisp at any text size.
+    float distance = texture(uTexture, TexCoord).r;
+    float width = fwidth(distance);
+    float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+    FragColor = vec4(Color.rgb, Color.a * alpha);
+}
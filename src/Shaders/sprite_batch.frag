@@ -0,0 +1,12 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoord;
+in vec4 Color;
+
+uniform sampler2D uTexture;
+
+void main() {
+    // Untextured sprites are drawn with a 1x1 white texture
+    FragColor = texture(uTexture, TexCoord) * Color;
+}
@@ -0,0 +1,20 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColor;
+
+out vec2 TexCoord;
+out vec4 Color;
+
+// Per-frame data shared by all programs (FrameUniforms.h)
+layout (std140) uniform FrameData {
+    mat4 projection;  // projection * view
+    float time;
+};
+
+void main() {
+    // Vertices are already in world space
+    gl_Position = projection * vec4(aPos, 0.0, 1.0);
+    TexCoord = aTexCoord;
+    Color = aColor;
+}
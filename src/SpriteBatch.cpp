@@ -0,0 +1,214 @@
+#include "SpriteBatch.h"
+#include "Shader.h"
+#include "Sprite.h"
+#include "Texture.h"
+#include "FrameUniforms.h"
+#include "RenderBackend.h"
+#include "Core/JobSystem.h"
+#include <glad/glad.h>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+SpriteBatch::SpriteBatch()
+    : VAO(0), VBO(0), EBO(0), shader(nullptr), whiteTexture(nullptr), currentTexture(nullptr),
+      drawing(false), drawCalls(0), spriteCount(0) {
+}
+
+SpriteBatch::~SpriteBatch() {
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+    if (VBO) glDeleteBuffers(1, &VBO);
+    if (EBO) glDeleteBuffers(1, &EBO);
+    delete whiteTexture;
+}
+
+void SpriteBatch::Init() {
+    if (RenderBackend::IsNull()) return;
+
+    vertices.reserve(MAX_SPRITES * 4);
+    SetupBuffers();
+
+    unsigned char white[4] = { 255, 255, 255, 255 };
+    whiteTexture = new Texture(1, 1, white, 4);
+}
+
+void SpriteBatch::SetupBuffers() {
+    // Static index buffer: two triangles per quad
+    std::vector<unsigned short> indices(MAX_SPRITES * 6);
+    for (int i = 0; i < MAX_SPRITES; i++) {
+        unsigned short base = static_cast<unsigned short>(i * 4);
+        indices[i * 6 + 0] = base + 0;
+        indices[i * 6 + 1] = base + 1;
+        indices[i * 6 + 2] = base + 2;
+        indices[i * 6 + 3] = base + 2;
+        indices[i * 6 + 4] = base + 3;
+        indices[i * 6 + 5] = base + 0;
+    }
+
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+
+    glBindVertexArray(VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, MAX_SPRITES * 4 * sizeof(SpriteVertex), nullptr, GL_STREAM_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned short), indices.data(), GL_STATIC_DRAW);
+
+    // Position attribute
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, x));
+    glEnableVertexAttribArray(0);
+
+    // Texture coord attribute
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, u));
+    glEnableVertexAttribArray(1);
+
+    // Color attribute
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, r));
+    glEnableVertexAttribArray(2);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void SpriteBatch::Begin(Shader* shader, const float* projView) {
+    if (drawing) {
+        Flush();
+    }
+
+    this->shader = shader;
+    drawing = true;
+    currentTexture = nullptr;
+    vertices.clear();
+
+    std::memcpy(projection, projView, sizeof(projection));
+
+    shader->Use();
+    shader->SetInt("uTexture", 0);
+    FrameUniforms::SetProjection(projection);
+}
+
+void SpriteBatch::SetTexture(Texture* texture) {
+    if (!texture) texture = whiteTexture;
+    if (texture != currentTexture) {
+        Flush();
+        currentTexture = texture;
+    }
+}
+
+void SpriteBatch::Draw(const Sprite& sprite) {
+    if (!drawing) return;
+
+    SetTexture(sprite.texture);
+    if (vertices.size() >= MAX_SPRITES * 4) {
+        Flush();
+    }
+
+    // Same transform as Sprite::GetModelMatrix, done on the CPU:
+    // scale to size, rotate around the center, translate to position
+    float halfW = sprite.width * 0.5f;
+    float halfH = sprite.height * 0.5f;
+    float centerX = sprite.x + halfW;
+    float centerY = sprite.y + halfH;
+
+    float radians = sprite.rotation * (float)M_PI / 180.0f;
+    float cosA = 1.0f;
+    float sinA = 0.0f;
+    if (radians != 0.0f) {
+        cosA = std::cos(radians);
+        sinA = std::sin(radians);
+    }
+
+    // Quad corners in unit space, counter-clockwise from bottom-left
+    static const float corners[4][2] = {
+        { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }
+    };
+
+    for (int i = 0; i < 4; i++) {
+        float lx = corners[i][0] * sprite.width - halfW;
+        float ly = corners[i][1] * sprite.height - halfH;
+
+        SpriteVertex vertex;
+        vertex.x = lx * cosA - ly * sinA + centerX;
+        vertex.y = lx * sinA + ly * cosA + centerY;
+        vertex.u = sprite.uv[0] + (sprite.uv[2] - sprite.uv[0]) * corners[i][0];
+        vertex.v = sprite.uv[1] + (sprite.uv[3] - sprite.uv[1]) * corners[i][1];
+        vertex.r = sprite.color[0];
+        vertex.g = sprite.color[1];
+        vertex.b = sprite.color[2];
+        vertex.a = sprite.color[3];
+        vertices.push_back(vertex);
+    }
+
+    spriteCount++;
+}
+
+void SpriteBatch::DrawQuad(const SpriteVertex quad[4], Texture* texture) {
+    if (!drawing) return;
+
+    SetTexture(texture);
+    if (vertices.size() >= MAX_SPRITES * 4) {
+        Flush();
+    }
+
+    vertices.insert(vertices.end(), quad, quad + 4);
+    spriteCount++;
+}
+
+void SpriteBatch::Flush() {
+    if (vertices.empty() || !shader) return;
+    if (RenderBackend::IsNull()) {
+        vertices.clear();
+        return;
+    }
+    MOLGA_ASSERT_MAIN_THREAD("SpriteBatch::Flush");
+
+    // Another pass may have bound its own program or changed the shared
+    // projection since Begin
+    shader->Use();
+    FrameUniforms::SetProjection(projection);
+    currentTexture->Bind(0);
+
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+    // Orphan the previous storage so the driver doesn't stall on a buffer
+    // that is still in use by an earlier draw
+    glBufferData(GL_ARRAY_BUFFER, MAX_SPRITES * 4 * sizeof(SpriteVertex), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(SpriteVertex), vertices.data());
+
+    GLsizei indexCount = static_cast<GLsizei>(vertices.size() / 4 * 6);
+    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, (void*)0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    vertices.clear();
+    drawCalls++;
+}
+
+void SpriteBatch::SetShader(Shader* newShader) {
+    if (newShader == shader || !newShader) return;
+
+    if (drawing) {
+        Flush();
+        newShader->Use();
+        newShader->SetInt("uTexture", 0);
+    }
+    shader = newShader;
+}
+
+void SpriteBatch::End() {
+    if (!drawing) return;
+
+    Flush();
+    drawing = false;
+    shader = nullptr;
+    currentTexture = nullptr;
+}
@@ -0,0 +1,69 @@
+#ifndef MOLGA_SPRITE_BATCH_H
+#define MOLGA_SPRITE_BATCH_H
+
+#include <vector>
+
+class Shader;
+class Sprite;
+class Texture;
+
+// Vertex layout used by the batched sprite shader (Shaders/sprite_batch.vert)
+struct SpriteVertex {
+    float x, y;        // World-space position
+    float u, v;        // Texture coordinates
+    float r, g, b, a;  // Tint color
+};
+
+// Collects sprites as world-space quads on the CPU and draws them with as
+// few draw calls as possible. The batch is flushed when the texture changes,
+// when the vertex buffer is full, or on End().
+class SpriteBatch {
+public:
+    static constexpr int MAX_SPRITES = 8192;
+
+    SpriteBatch();
+    ~SpriteBatch();
+
+    void Init();
+
+    void Begin(Shader* shader, const float* projView);
+    void Draw(const Sprite& sprite);
+    void DrawQuad(const SpriteVertex quad[4], Texture* texture);
+    void End();
+
+    // Submit pending quads to the GPU
+    void Flush();
+
+    // Switch programs without ending the batch (e.g. for SDF text between
+    // sprites). Pending quads are drawn with the previous program first.
+    void SetShader(Shader* shader);
+    Shader* GetShader() const { return shader; }
+
+    bool IsDrawing() const { return drawing; }
+
+    // Stats (accumulated until ResetStats)
+    int GetDrawCalls() const { return drawCalls; }
+    int GetSpriteCount() const { return spriteCount; }
+    void ResetStats() { drawCalls = 0; spriteCount = 0; }
+
+private:
+    void SetupBuffers();
+    void SetTexture(Texture* texture);
+
+    unsigned int VAO;
+    unsigned int VBO;
+    unsigned int EBO;
+
+    Shader* shader;
+    Texture* whiteTexture;    // Used for untextured sprites so they batch together
+    Texture* currentTexture;
+
+    std::vector<SpriteVertex> vertices;
+    float projection[16];
+    bool drawing;
+
+    int drawCalls;
+    int spriteCount;
+};
+
+#endif // MOLGA_SPRITE_BATCH_H
@@ -0,0 +1,309 @@
+#include "SpriteCuller.h"
+#include "Renderer.h"
+#include "RenderQueue.h"
+#include "Sprite.h"
+#include "Camera2D.h"
+#include "ECS/GameObject.h"
+#include "ECS/Components/Transform.h"
+#include "ECS/Components/SpriteRenderer.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+SpriteCuller& SpriteCuller::Get() {
+    static SpriteCuller instance;
+    return instance;
+}
+
+void SpriteCuller::Register(SpriteRenderer* sprite) {
+    if (!sprite || sprite->cullId >= 0) return;
+
+    int id;
+    if (!freeEntries.empty()) {
+        id = freeEntries.back();
+        freeEntries.pop_back();
+    } else {
+        id = static_cast<int>(entries.size());
+        entries.emplace_back();
+    }
+
+    Entry& entry = entries[id];
+    entry = Entry();
+    entry.sprite = sprite;
+    entry.sequence = nextSequence++;
+    entry.isStatic = sprite->IsStatic();
+    sprite->cullId = id;
+
+    if (entry.isStatic) {
+        pendingStatic.push_back(id);
+        staticCount++;
+    } else {
+        entry.dynamicIndex = static_cast<int>(dynamicEntries.size());
+        dynamicEntries.push_back(id);
+    }
+}
+
+void SpriteCuller::Unregister(SpriteRenderer* sprite) {
+    if (!sprite || sprite->cullId < 0) return;
+
+    int id = sprite->cullId;
+    Entry& entry = entries[id];
+    if (entry.isStatic) {
+        RemoveFromCells(id);
+        pendingStatic.erase(std::remove(pendingStatic.begin(), pendingStatic.end(), id), pendingStatic.end());
+        staticCount--;
+    } else {
+        int last = dynamicEntries.back();
+        dynamicEntries[entry.dynamicIndex] = last;
+        entries[last].dynamicIndex = entry.dynamicIndex;
+        dynamicEntries.pop_back();
+    }
+
+    entry.sprite = nullptr;
+    freeEntries.push_back(id);
+    sprite->cullId = -1;
+}
+
+void SpriteCuller::Refresh(SpriteRenderer* sprite) {
+    if (!sprite || sprite->cullId < 0) return;
+
+    int id = sprite->cullId;
+    if (!entries[id].isStatic) return;
+
+    RemoveFromCells(id);
+    if (std::find(pendingStatic.begin(), pendingStatic.end(), id) == pendingStatic.end()) {
+        pendingStatic.push_back(id);
+    }
+}
+
+void SpriteCuller::SetCellSize(float size) {
+    if (size <= 0.0f || size == cellSize) return;
+
+    cellSize = size;
+    cells.clear();
+    for (int id = 0; id < static_cast<int>(entries.size()); id++) {
+        Entry& entry = entries[id];
+        if (entry.sprite && entry.isStatic && entry.inGrid) {
+            entry.inGrid = false;
+            pendingStatic.push_back(id);
+        }
+    }
+}
+
+void SpriteCuller::Clear() {
+    for (auto& entry : entries) {
+        if (entry.sprite) entry.sprite->cullId = -1;
+    }
+    entries.clear();
+    freeEntries.clear();
+    dynamicEntries.clear();
+    pendingStatic.clear();
+    cells.clear();
+    visible.clear();
+    visibleScratch.clear();
+    staticCount = 0;
+    stats = CullStats();
+}
+
+void SpriteCuller::InsertIntoCells(int id) {
+    Entry& entry = entries[id];
+    for (int y = entry.minY; y <= entry.maxY; y++) {
+        for (int x = entry.minX; x <= entry.maxX; x++) {
+            cells[CellKey(x, y)].push_back(id);
+        }
+    }
+    entry.inGrid = true;
+}
+
+void SpriteCuller::RemoveFromCells(int id) {
+    Entry& entry = entries[id];
+    if (!entry.inGrid) return;
+
+    for (int y = entry.minY; y <= entry.maxY; y++) {
+        for (int x = entry.minX; x <= entry.maxX; x++) {
+            auto it = cells.find(CellKey(x, y));
+            if (it == cells.end()) continue;
+
+            std::vector<int>& bucket = it->second;
+            auto found = std::find(bucket.begin(), bucket.end(), id);
+            if (found != bucket.end()) {
+                *found = bucket.back();
+                bucket.pop_back();
+            }
+            if (bucket.empty()) {
+                cells.erase(it);
+            }
+        }
+    }
+    entry.inGrid = false;
+}
+
+void SpriteCuller::IndexPending() {
+    for (int id : pendingStatic) {
+        Entry& entry = entries[id];
+        GameObject* owner = entry.sprite->GetGameObject();
+        const Transform* transform = owner ? owner->GetComponent<Transform>() : nullptr;
+        if (!transform) continue;     // Nothing to draw it with; Refresh() retries
+
+        entry.bounds = entry.sprite->GetWorldBounds(*transform);
+        entry.minX = static_cast<int>(std::floor(entry.bounds.Left() / cellSize));
+        entry.minY = static_cast<int>(std::floor(entry.bounds.Top() / cellSize));
+        entry.maxX = static_cast<int>(std::floor(entry.bounds.Right() / cellSize));
+        entry.maxY = static_cast<int>(std::floor(entry.bounds.Bottom() / cellSize));
+        InsertIntoCells(id);
+    }
+    pendingStatic.clear();
+}
+
+const Transform* SpriteCuller::GetDrawableTransform(const SpriteRenderer* sprite) {
+    const GameObject* owner = sprite->GetGameObject();
+    if (!sprite->IsEnabled() || !owner || !owner->IsActive()) return nullptr;
+    return owner->GetComponent<Transform>();
+}
+
+void SpriteCuller::AddVisible(const Entry& entry, const Transform* transform) {
+    visible.push_back({ entry.sprite, transform, entry.sequence });
+}
+
+void SpriteCuller::Cull(const AABB& view) {
+    Collect(&view);
+}
+
+void SpriteCuller::Collect(const AABB* view) {
+    MOLGA_PROFILE("SpriteCuller::Cull");
+
+    if (!enabled) view = nullptr;
+
+    visible.clear();
+    stats.tested = 0;
+    cullCount++;
+
+    IndexPending();
+
+    // Moving sprites: one bounds test each
+    for (int id : dynamicEntries) {
+        const Entry& entry = entries[id];
+        const Transform* transform = GetDrawableTransform(entry.sprite);
+        if (!transform) continue;
+
+        if (view) {
+            stats.tested++;
+            if (!view->Intersects(entry.sprite->GetWorldBounds(*transform))) continue;
+        }
+        AddVisible(entry, transform);
+    }
+
+    // Static sprites: only those in cells under the view. A sprite spanning
+    // several cells is tested once.
+    auto visitCell = [this, view](const std::vector<int>& bucket) {
+        for (int id : bucket) {
+            Entry& entry = entries[id];
+            if (entry.lastVisit == cullCount) continue;
+            entry.lastVisit = cullCount;
+
+            stats.tested++;
+            if (!view->Intersects(entry.bounds)) continue;
+
+            const Transform* transform = GetDrawableTransform(entry.sprite);
+            if (transform) AddVisible(entry, transform);
+        }
+    };
+
+    if (!view) {
+        for (const Entry& entry : entries) {
+            if (!entry.sprite || !entry.isStatic) continue;
+            const Transform* transform = GetDrawableTransform(entry.sprite);
+            if (transform) AddVisible(entry, transform);
+        }
+    } else if (!cells.empty()) {
+        float firstX = std::floor(view->Left() / cellSize);
+        float firstY = std::floor(view->Top() / cellSize);
+        float lastX = std::floor(view->Right() / cellSize);
+        float lastY = std::floor(view->Bottom() / cellSize);
+
+        // Zoomed far out, walking the occupied cells is cheaper
+        double viewCells = (static_cast<double>(lastX) - firstX + 1.0) * (static_cast<double>(lastY) - firstY + 1.0);
+        if (viewCells > static_cast<double>(cells.size())) {
+            for (const auto& cell : cells) {
+                visitCell(cell.second);
+            }
+        } else {
+            for (int y = static_cast<int>(firstY); y <= static_cast<int>(lastY); y++) {
+                for (int x = static_cast<int>(firstX); x <= static_cast<int>(lastX); x++) {
+                    auto it = cells.find(CellKey(x, y));
+                    if (it != cells.end()) visitCell(it->second);
+                }
+            }
+        }
+    }
+
+    stats.sprites = static_cast<int>(entries.size() - freeEntries.size());
+    stats.staticSprites = staticCount;
+    stats.visible = static_cast<int>(visible.size());
+}
+
+void SpriteCuller::Render(Renderer* renderer, Shader* shader, Camera2D* camera) {
+    if (camera) {
+        AABB view = camera->GetWorldBounds();
+        Collect(&view);
+    } else {
+        Collect(nullptr);
+    }
+
+    // Cells hand out sprites in no particular order, and draw order must not
+    // change as the view moves. The depth bits get each sprite's rank in
+    // registration order this frame, which unlike the sequence itself fits
+    // them. Past 65535 visible sprites the rank saturates and the queue's
+    // stable sort keeps the submission order.
+    SortVisible();
+
+    RenderQueue& queue = RenderQueue::Get();
+    for (size_t rank = 0; rank < visible.size(); rank++) {
+        const VisibleSprite& entry = visible[rank];
+        Sprite sprite;
+        entry.sprite->BuildSprite(*entry.transform, sprite);
+        queue.Submit(sprite, entry.sprite->GetSortingLayer(), entry.sprite->GetSortingOrder(),
+                     static_cast<uint16_t>(std::min<size_t>(rank, UINT16_MAX)));
+    }
+    queue.Flush(renderer, shader, camera);
+}
+
+void SpriteCuller::SortVisible() {
+    size_t count = visible.size();
+    if (count < 2) return;
+
+    uint32_t histograms[4][256] = {};
+    for (const VisibleSprite& entry : visible) {
+        for (int byte = 0; byte < 4; byte++) {
+            histograms[byte][(entry.sequence >> (byte * 8)) & 0xFF]++;
+        }
+    }
+
+    visibleScratch.resize(count);
+    VisibleSprite* source = visible.data();
+    VisibleSprite* target = visibleScratch.data();
+
+    for (int byte = 0; byte < 4; byte++) {
+        int shift = byte * 8;
+        uint32_t* histogram = histograms[byte];
+
+        // Fewer than 16M registrations leave the high byte unused
+        if (histogram[(source[0].sequence >> shift) & 0xFF] == count) continue;
+
+        uint32_t offset = 0;
+        for (int value = 0; value < 256; value++) {
+            uint32_t bucket = histogram[value];
+            histogram[value] = offset;
+            offset += bucket;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            target[histogram[(source[i].sequence >> shift) & 0xFF]++] = source[i];
+        }
+        std::swap(source, target);
+    }
+
+    if (source != visible.data()) {
+        visible.swap(visibleScratch);
+    }
+}
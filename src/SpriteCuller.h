@@ -0,0 +1,122 @@
+#ifndef MOLGA_SPRITE_CULLER_H
+#define MOLGA_SPRITE_CULLER_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "Common/Types.h"
+
+class SpriteRenderer;
+class Transform;
+class Renderer;
+class Shader;
+class Camera2D;
+
+struct CullStats {
+    int sprites = 0;            // Registered SpriteRenderers
+    int staticSprites = 0;      // Of those, kept in the static grid
+    int tested = 0;             // Bounds tests in the last Cull()
+    int visible = 0;            // Sprites that passed
+};
+
+struct VisibleSprite {
+    SpriteRenderer* sprite;
+    const Transform* transform;
+    uint32_t sequence;          // Registration order
+};
+
+// Visibility pass for SpriteRenderer components. Sprites register
+// themselves on attach. Moving sprites are tested against the view every
+// frame; static ones (SpriteRenderer::SetStatic) are kept in a uniform grid
+// by their bounds, so only the cells under the view are visited and
+// off-screen static sprites cost nothing.
+//
+// Static bounds are read when the sprite is registered or refreshed, at the
+// start of the next Cull(). Moving a static sprite without calling
+// Refresh() leaves it drawn (and culled) where it was indexed.
+class SpriteCuller {
+public:
+    static SpriteCuller& Get();
+
+    // Called by SpriteRenderer::OnAttach/OnDetach/SetStatic
+    void Register(SpriteRenderer* sprite);
+    void Unregister(SpriteRenderer* sprite);
+
+    // Re-read a static sprite's bounds after it was moved or resized
+    void Refresh(SpriteRenderer* sprite);
+
+    // Collect the active, enabled sprites overlapping view into GetVisible(),
+    // in no particular order
+    void Cull(const AABB& view);
+    const std::vector<VisibleSprite>& GetVisible() const { return visible; }
+
+    // Cull against the camera's view (everything without a camera) and draw
+    // the visible sprites through the RenderQueue, into the renderer's pass
+    // if one is open. Ties in sorting layer and order, shader and texture
+    // are broken by registration order.
+    void Render(Renderer* renderer, Shader* shader, Camera2D* camera);
+
+    // When disabled every active sprite counts as visible (for comparisons)
+    void SetEnabled(bool value) { enabled = value; }
+    bool IsEnabled() const { return enabled; }
+
+    // Cell size of the static grid in world units (re-indexes static sprites)
+    void SetCellSize(float size);
+    float GetCellSize() const { return cellSize; }
+
+    // Forget all sprites
+    void Clear();
+
+    const CullStats& GetStats() const { return stats; }
+
+private:
+    SpriteCuller() = default;
+    SpriteCuller(const SpriteCuller&) = delete;
+    SpriteCuller& operator=(const SpriteCuller&) = delete;
+
+    struct Entry {
+        SpriteRenderer* sprite = nullptr;
+        uint32_t sequence = 0;
+        bool isStatic = false;
+        bool inGrid = false;
+        int dynamicIndex = -1;                          // Slot in dynamicEntries
+        AABB bounds;                                    // Static: indexed bounds
+        int minX = 0, minY = 0, maxX = -1, maxY = -1;   // Occupied cell range
+        unsigned int lastVisit = 0;                     // Cull() that last tested it
+    };
+
+    static uint64_t CellKey(int x, int y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    // Cull(), or no culling when view is nullptr
+    void Collect(const AABB* view);
+    void IndexPending();
+    void InsertIntoCells(int id);
+    void RemoveFromCells(int id);
+    void AddVisible(const Entry& entry, const Transform* transform);
+
+    // Order visible by registration sequence (LSD radix sort, linear)
+    void SortVisible();
+
+    // Owner's Transform when the sprite should be drawn at all
+    static const Transform* GetDrawableTransform(const SpriteRenderer* sprite);
+
+    float cellSize = 256.0f;
+    bool enabled = true;
+
+    std::vector<Entry> entries;
+    std::vector<int> freeEntries;
+    std::vector<int> dynamicEntries;
+    std::vector<int> pendingStatic;                     // Indexed at the next Cull()
+    std::unordered_map<uint64_t, std::vector<int>> cells;
+    std::vector<VisibleSprite> visible;
+    std::vector<VisibleSprite> visibleScratch;          // SortVisible() buffer
+
+    uint32_t nextSequence = 0;
+    unsigned int cullCount = 0;
+    int staticCount = 0;
+    CullStats stats;
+};
+
+#endif // MOLGA_SPRITE_CULLER_H
@@ -0,0 +1,183 @@
+#include "TextMesh.h"
+#include "TextRenderer.h"
+#include "Font.h"
+#include "Renderer.h"
+#include "Shader.h"
+#include "Texture.h"
+#include "FrameUniforms.h"
+#include "RenderBackend.h"
+#include "Core/Profiler.h"
+#include "Core/JobSystem.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+TextMesh::~TextMesh() {
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+    if (VBO) glDeleteBuffers(1, &VBO);
+    if (EBO) glDeleteBuffers(1, &EBO);
+}
+
+void TextMesh::SetText(const std::string& newText, float newScale, const Color& newColor) {
+    if (!dirty && newText == text && newScale == scale && newColor == color) return;
+
+    text = newText;
+    scale = newScale;
+    color = newColor;
+    dirty = true;
+}
+
+void TextMesh::SetFont(const Font* newFont) {
+    if (newFont == font) return;
+    font = newFont;
+    dirty = true;
+}
+
+float TextMesh::GetWidth() {
+    if (dirty) Rebuild();
+    return width;
+}
+
+float TextMesh::GetHeight() {
+    if (dirty) Rebuild();
+    return height;
+}
+
+int TextMesh::GetGlyphCount() {
+    if (dirty) Rebuild();
+    return static_cast<int>(vertices.size() / 4);
+}
+
+void TextMesh::Rebuild() {
+    MOLGA_PROFILE("TextMesh::Rebuild");
+
+    vertices.clear();
+    if (font) {
+        font->Layout(text, 0.0f, 0.0f, scale, color, vertices);
+        width = font->GetTextWidth(text, scale);
+    } else {
+        TextRenderer& builtin = TextRenderer::Get();
+        builtin.Layout(text, 0.0f, 0.0f, scale, color, vertices);
+        width = builtin.GetTextWidth(text, scale);
+    }
+
+    height = 0.0f;
+    for (const SpriteVertex& vertex : vertices) {
+        height = std::max(height, vertex.y);
+    }
+
+    dirty = false;
+    uploadPending = true;
+}
+
+void TextMesh::SetupBuffers() {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+
+    // Same layout as SpriteBatch, so the batch shader draws it unchanged
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, x));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, u));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)offsetof(SpriteVertex, r));
+    glEnableVertexAttribArray(2);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void TextMesh::Upload() {
+    if (!VAO) SetupBuffers();
+
+    int quads = static_cast<int>(vertices.size() / 4);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+    // Grow geometrically so text that keeps getting longer reallocates rarely
+    if (quads > quadCapacity) {
+        quadCapacity = std::max(quads, quadCapacity * 2);
+
+        std::vector<unsigned int> indices(quadCapacity * 6);
+        for (int i = 0; i < quadCapacity; i++) {
+            unsigned int base = static_cast<unsigned int>(i * 4);
+            indices[i * 6 + 0] = base + 0;
+            indices[i * 6 + 1] = base + 1;
+            indices[i * 6 + 2] = base + 2;
+            indices[i * 6 + 3] = base + 2;
+            indices[i * 6 + 4] = base + 3;
+            indices[i * 6 + 5] = base + 0;
+        }
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, quadCapacity * 4 * sizeof(SpriteVertex), nullptr, GL_DYNAMIC_DRAW);
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(SpriteVertex), vertices.data());
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    uploadPending = false;
+}
+
+void TextMesh::Draw(Renderer* renderer, float x, float y, Camera2D* camera) {
+    if (dirty) Rebuild();
+    if (vertices.empty()) return;
+
+    Texture* fontTexture = font ? font->GetTexture() : TextRenderer::Get().GetFontTexture();
+    Shader* sdfShader = TextRenderer::Get().GetSdfShader();
+    if (!fontTexture || (font && !sdfShader)) return;
+
+    // Inside an open batch: copy the cached quads, offset, into it
+    if (renderer->IsBatching()) {
+        SpriteBatch& batch = renderer->GetSpriteBatch();
+        Shader* previous = batch.GetShader();
+        if (font) batch.SetShader(sdfShader);
+
+        SpriteVertex quad[4];
+        for (size_t i = 0; i < vertices.size(); i += 4) {
+            for (int corner = 0; corner < 4; corner++) {
+                quad[corner] = vertices[i + corner];
+                quad[corner].x += x;
+                quad[corner].y += y;
+            }
+            batch.DrawQuad(quad, fontTexture);
+        }
+
+        if (font) batch.SetShader(previous);
+        return;
+    }
+
+    // The retained buffer is drawn with the batch shader (same vertex layout)
+    Shader* shader = font ? sdfShader : renderer->GetBatchShader();
+    if (!shader || RenderBackend::IsNull()) return;
+    MOLGA_ASSERT_MAIN_THREAD("TextMesh::Draw");
+    MOLGA_PROFILE("TextMesh::Draw");
+
+    if (uploadPending) Upload();
+
+    // Translate through the projection instead of moving the vertices
+    mat4x4 projView, translation, transform;
+    renderer->GetProjectionView(camera, projView);
+    mat4x4_translate(translation, x, y, 0.0f);
+    mat4x4_mul(transform, projView, translation);
+
+    // Put the projection back afterwards: later draws rely on the one the
+    // frame set up
+    mat4x4 savedProjection;
+    std::memcpy(savedProjection, FrameUniforms::GetProjection(), sizeof(savedProjection));
+
+    shader->Use();
+    shader->SetInt("uTexture", 0);
+    FrameUniforms::SetProjection((float*)transform);
+    fontTexture->Bind(0);
+
+    glBindVertexArray(VAO);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(vertices.size() / 4 * 6), GL_UNSIGNED_INT, (void*)0);
+    glBindVertexArray(0);
+
+    FrameUniforms::SetProjection((float*)savedProjection);
+}
@@ -0,0 +1,70 @@
+#ifndef MOLGA_TEXT_MESH_H
+#define MOLGA_TEXT_MESH_H
+
+#include <string>
+#include <vector>
+#include "Common/Types.h"
+#include "SpriteBatch.h"
+
+class Renderer;
+class Camera2D;
+class Font;
+
+// Retained text: the glyph quads of a string are laid out once and kept in
+// a vertex buffer, and only rebuilt when the text, scale or color change.
+// Moving the mesh costs nothing; Draw translates it through the projection.
+//
+//   TextMesh score;
+//   score.SetText("Score: 100", 2.0f);      // No-op while unchanged
+//   score.Draw(renderer, 10.0f, 10.0f);
+class TextMesh {
+public:
+    TextMesh() = default;
+    ~TextMesh();
+
+    TextMesh(const TextMesh&) = delete;
+    TextMesh& operator=(const TextMesh&) = delete;
+
+    // scale multiplies the built-in 8 pixel font; with a Font it is the
+    // size in pixels per line
+    void SetText(const std::string& text, float scale = 1.0f, const Color& color = Color::White());
+
+    // TrueType font to lay out with (drawn with the SDF shader), or nullptr
+    // for the built-in font. The font must outlive the mesh.
+    void SetFont(const Font* font);
+
+    const std::string& GetText() const { return text; }
+    float GetWidth();
+    float GetHeight();
+    int GetGlyphCount();
+
+    // Draw with the top-left of the text at (x, y). Between renderer
+    // Begin/End the quads are appended to the open sprite batch, so meshes
+    // and RenderText strings sharing the font texture go out in one draw
+    // call; otherwise the mesh draws its own buffer in one call.
+    // Font meshes swap the SDF shader into an open batch for their quads.
+    void Draw(Renderer* renderer, float x, float y, Camera2D* camera = nullptr);
+
+private:
+    void Rebuild();
+    void Upload();
+    void SetupBuffers();
+
+    std::string text;
+    const Font* font = nullptr;
+    float scale = 1.0f;
+    Color color;
+
+    std::vector<SpriteVertex> vertices;     // Laid out at (0, 0)
+    float width = 0.0f;
+    float height = 0.0f;
+    bool dirty = true;                      // Layout is stale
+    bool uploadPending = true;              // GPU copy is stale
+
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    unsigned int EBO = 0;
+    int quadCapacity = 0;                   // Quads the GPU buffers can hold
+};
+
+#endif // MOLGA_TEXT_MESH_H
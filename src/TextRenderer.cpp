@@ -3,6 +3,8 @@
 #include "Renderer.h"
 #include "Shader.h"
 #include "Sprite.h"
+#include "Font.h"
+#include <algorithm>
 #include <cstring>
 
 // Simple 8x8 bitmap font data (ASCII 32-126)
@@ -225,7 +227,9 @@ void TextRenderer::Shutdown() {
         delete fontTexture;
         fontTexture = nullptr;
     }
-    characters.clear();
+    for (CharInfo& glyph : glyphs) {
+        glyph = CharInfo();
+    }
     initialized = false;
 }
 
@@ -268,8 +272,7 @@ void TextRenderer::GenerateBuiltinFont() {
         }
 
         // Store character info
-        char c = static_cast<char>(32 + charIdx);
-        CharInfo info;
+        CharInfo& info = glyphs[32 + charIdx];
         info.u0 = static_cast<float>(col * CHAR_WIDTH) / texWidth;
         info.v0 = static_cast<float>(row * CHAR_HEIGHT) / texHeight;
         info.u1 = static_cast<float>((col + 1) * CHAR_WIDTH) / texWidth;
@@ -279,7 +282,7 @@ void TextRenderer::GenerateBuiltinFont() {
         info.xOffset = 0;
         info.yOffset = 0;
         info.xAdvance = static_cast<float>(CHAR_WIDTH);
-        characters[c] = info;
+        info.valid = true;
     }
 
     // Create texture
@@ -289,16 +292,11 @@ void TextRenderer::GenerateBuiltinFont() {
     delete[] textureData;
 }
 
-void TextRenderer::RenderText(Renderer* renderer, Shader* shader,
-                               const std::string& text, float x, float y,
-                               float scale, const Color& color) {
-    if (!initialized || !fontTexture) return;
-
+void TextRenderer::Layout(const std::string& text, float x, float y, float scale, const Color& color,
+                          std::vector<SpriteVertex>& out) const {
     float cursorX = x;
     float cursorY = y;
 
-    renderer->Begin(shader, nullptr);
-
     for (char c : text) {
         if (c == '\n') {
             cursorX = x;
@@ -306,28 +304,111 @@ void TextRenderer::RenderText(Renderer* renderer, Shader* shader,
             continue;
         }
 
-        auto it = characters.find(c);
-        if (it == characters.end()) {
-            // Unknown character, skip or use space
-            cursorX += 8.0f * scale;
+        const CharInfo& info = glyphs[static_cast<unsigned char>(c)];
+        if (!info.valid) {
+            cursorX += UNKNOWN_ADVANCE * scale;
             continue;
         }
 
-        const CharInfo& info = it->second;
-
-        Sprite sprite;
-        sprite.SetTexture(fontTexture);
-        sprite.SetPosition(cursorX + info.xOffset * scale, cursorY + info.yOffset * scale);
-        sprite.SetSize(info.width * scale, info.height * scale);
-        sprite.SetColor(color.r, color.g, color.b, color.a);
-        sprite.SetUV(info.u0, info.v0, info.u1, info.v1);
+        // Counter-clockwise from the glyph's top-left, matching SpriteBatch
+        float x0 = cursorX + info.xOffset * scale;
+        float y0 = cursorY + info.yOffset * scale;
+        float x1 = x0 + info.width * scale;
+        float y1 = y0 + info.height * scale;
 
-        renderer->DrawSprite(&sprite);
+        out.push_back({ x0, y0, info.u0, info.v0, color.r, color.g, color.b, color.a });
+        out.push_back({ x1, y0, info.u1, info.v0, color.r, color.g, color.b, color.a });
+        out.push_back({ x1, y1, info.u1, info.v1, color.r, color.g, color.b, color.a });
+        out.push_back({ x0, y1, info.u0, info.v1, color.r, color.g, color.b, color.a });
 
         cursorX += info.xAdvance * scale;
     }
+}
+
+void TextRenderer::RenderText(Renderer* renderer, Shader* shader,
+                               const std::string& text, float x, float y,
+                               float scale, const Color& color) {
+    if (!initialized || !fontTexture) return;
+
+    // Join a batch the caller already opened instead of starting a pass
+    bool ownPass = !renderer->IsBatching();
+    if (ownPass) {
+        renderer->Begin(shader, nullptr);
+    }
+
+    if (renderer->IsBatching()) {
+        scratch.clear();
+        Layout(text, x, y, scale, color, scratch);
+
+        SpriteBatch& batch = renderer->GetSpriteBatch();
+        for (size_t i = 0; i < scratch.size(); i += 4) {
+            batch.DrawQuad(&scratch[i], fontTexture);
+        }
+    } else {
+        // No batch shader: one sprite per glyph
+        float cursorX = x;
+        float cursorY = y;
+        for (char c : text) {
+            if (c == '\n') {
+                cursorX = x;
+                cursorY += lineHeight * scale * lineSpacing;
+                continue;
+            }
 
-    renderer->End();
+            const CharInfo& info = glyphs[static_cast<unsigned char>(c)];
+            if (!info.valid) {
+                cursorX += UNKNOWN_ADVANCE * scale;
+                continue;
+            }
+
+            Sprite sprite;
+            sprite.SetTexture(fontTexture);
+            sprite.SetPosition(cursorX + info.xOffset * scale, cursorY + info.yOffset * scale);
+            sprite.SetSize(info.width * scale, info.height * scale);
+            sprite.SetColor(color.r, color.g, color.b, color.a);
+            sprite.SetUV(info.u0, info.v0, info.u1, info.v1);
+            renderer->DrawSprite(&sprite);
+
+            cursorX += info.xAdvance * scale;
+        }
+    }
+
+    if (ownPass) {
+        renderer->End();
+    }
+}
+
+void TextRenderer::RenderText(Renderer* renderer, const Font& font,
+                              const std::string& text, float x, float y,
+                              float size, const Color& color) {
+    Texture* atlas = font.GetTexture();
+    if (!sdfShader || !atlas) return;
+
+    // Open a batched pass; the batch is switched to the SDF program below
+    bool ownPass = !renderer->IsBatching();
+    if (ownPass) {
+        renderer->Begin(renderer->GetBatchShader(), nullptr);
+    }
+
+    // Without a batch shader there is no batch to draw the quads with
+    if (renderer->IsBatching()) {
+        scratch.clear();
+        font.Layout(text, x, y, size, color, scratch);
+
+        SpriteBatch& batch = renderer->GetSpriteBatch();
+        Shader* previous = batch.GetShader();
+        batch.SetShader(sdfShader);
+        for (size_t i = 0; i < scratch.size(); i += 4) {
+            batch.DrawQuad(&scratch[i], atlas);
+        }
+        if (!ownPass) {
+            batch.SetShader(previous);
+        }
+    }
+
+    if (ownPass) {
+        renderer->End();
+    }
 }
 
 float TextRenderer::GetTextWidth(const std::string& text, float scale) const {
@@ -341,15 +422,11 @@ float TextRenderer::GetTextWidth(const std::string& text, float scale) const {
             continue;
         }
 
-        auto it = characters.find(c);
-        if (it != characters.end()) {
-            width += it->second.xAdvance * scale;
-        } else {
-            width += 8.0f * scale;
-        }
+        const CharInfo& info = glyphs[static_cast<unsigned char>(c)];
+        width += info.valid ? info.xAdvance : UNKNOWN_ADVANCE;
     }
 
-    return std::max(maxWidth, width);
+    return std::max(maxWidth, width) * scale;
 }
 
 float TextRenderer::GetTextHeight(float scale) const {
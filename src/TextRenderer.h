@@ -2,12 +2,14 @@
 #define MOLGA_TEXT_RENDERER_H
 
 #include <string>
-#include <unordered_map>
+#include <vector>
 #include "Common/Types.h"
+#include "SpriteBatch.h"
 
 class Shader;
 class Renderer;
 class Texture;
+class Font;
 
 // Character info for bitmap font
 struct CharInfo {
@@ -15,6 +17,7 @@ struct CharInfo {
     float width, height;    // Size of character
     float xOffset, yOffset; // Offset from cursor position
     float xAdvance;         // How much to advance cursor after this char
+    bool valid = false;     // Has a glyph in the font texture
 };
 
 // Simple bitmap font text renderer
@@ -29,11 +32,30 @@ public:
     // Shutdown and cleanup
     void Shutdown();
 
-    // Render text at position
+    // Render text at position in screen space. With a batch shader the
+    // glyphs are drawn as one batch; called between renderer->Begin/End
+    // they join the open batch (and its projection), so every string
+    // sharing the font texture goes out in a single draw call.
+    // For text that rarely changes, TextMesh avoids the per-frame layout.
     void RenderText(Renderer* renderer, Shader* shader,
                     const std::string& text, float x, float y,
                     float scale = 1.0f, const Color& color = Color::White());
 
+    // Render UTF-8 text with a TrueType font, size pixels per line. The
+    // block is a single draw with the SDF shader: inside an open batch the
+    // shader is swapped in for it and back, otherwise it is its own pass.
+    void RenderText(Renderer* renderer, const Font& font,
+                    const std::string& text, float x, float y,
+                    float size, const Color& color = Color::White());
+
+    // Program for Font text (Shaders/sdf_text.frag with sprite_batch.vert)
+    void SetSdfShader(Shader* shader) { sdfShader = shader; }
+    Shader* GetSdfShader() const { return sdfShader; }
+
+    // Append one quad per glyph, laid out from (x, y), to out
+    void Layout(const std::string& text, float x, float y, float scale, const Color& color,
+                std::vector<SpriteVertex>& out) const;
+
     // Get text dimensions
     float GetTextWidth(const std::string& text, float scale = 1.0f) const;
     float GetTextHeight(float scale = 1.0f) const;
@@ -41,14 +63,21 @@ public:
     // Set line height multiplier
     void SetLineSpacing(float spacing) { lineSpacing = spacing; }
 
+    Texture* GetFontTexture() const { return fontTexture; }
+
     // Singleton access
     static TextRenderer& Get();
 
 private:
     void GenerateBuiltinFont();
 
+    // Advance of characters missing from the font
+    static constexpr float UNKNOWN_ADVANCE = 8.0f;
+
     Texture* fontTexture = nullptr;
-    std::unordered_map<char, CharInfo> characters;
+    Shader* sdfShader = nullptr;
+    CharInfo glyphs[256] = {};          // Indexed by byte value
+    std::vector<SpriteVertex> scratch;  // RenderText layout, reused
     float lineHeight = 16.0f;
     float lineSpacing = 1.2f;
     bool initialized = false;
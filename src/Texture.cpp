@@ -1,13 +1,30 @@
 #include "Texture.h"
+#include "RenderBackend.h"
+#include "Core/Profiler.h"
+#include "Core/JobSystem.h"
 #include <iostream>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
 Texture::Texture(const char* imagePath) : textureID(0), width(0), height(0), channels(0) {
+    MOLGA_PROFILE("Texture::Load");
+
+    // Nothing to upload: read the size from the header and skip decoding
+    if (RenderBackend::IsNull()) {
+        if (!stbi_info(imagePath, &width, &height, &channels)) {
+            std::cerr << "ERROR::TEXTURE::FILE_NOT_FOUND: " << imagePath << std::endl;
+        }
+        return;
+    }
+
     stbi_set_flip_vertically_on_load(true);
 
-    unsigned char* data = stbi_load(imagePath, &width, &height, &channels, 0);
+    unsigned char* data = nullptr;
+    {
+        MOLGA_PROFILE("Texture::Decode");
+        data = stbi_load(imagePath, &width, &height, &channels, 0);
+    }
     if (!data) {
         std::cerr << "ERROR::TEXTURE::FILE_NOT_FOUND: " << imagePath << std::endl;
         return;
@@ -17,15 +34,36 @@ Texture::Texture(const char* imagePath) : textureID(0), width(0), height(0), cha
     stbi_image_free(data);
 }
 
-Texture::Texture(int w, int h, unsigned char* data, int ch)
+Texture::Texture(int w, int h, const unsigned char* data, int ch)
     : textureID(0), width(0), height(0), channels(0) {
     CreateFromData(w, h, data, ch);
 }
 
-void Texture::CreateFromData(int w, int h, unsigned char* data, int ch) {
+void Texture::CreateFromData(int w, int h, const unsigned char* data, int ch) {
+    if (RenderBackend::IsNull()) {
+        Upload(w, h, data, ch);
+        return;
+    }
+
+    glGenTextures(1, &textureID);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    Upload(w, h, data, ch);
+}
+
+void Texture::Upload(int w, int h, const unsigned char* data, int ch) {
     width = w;
     height = h;
     channels = ch;
+    if (RenderBackend::IsNull()) return;
+    MOLGA_ASSERT_MAIN_THREAD("Texture::Upload");
 
     GLenum format = GL_RGBA;
     GLenum internalFormat = GL_RGBA;
@@ -40,14 +78,7 @@ void Texture::CreateFromData(int w, int h, unsigned char* data, int ch) {
         internalFormat = GL_RGBA;
     }
 
-    glGenTextures(1, &textureID);
     glBindTexture(GL_TEXTURE_2D, textureID);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
     glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, data);
 
     glBindTexture(GL_TEXTURE_2D, 0);
@@ -60,10 +91,12 @@ Texture::~Texture() {
 }
 
 void Texture::Bind(unsigned int slot) const {
+    if (!textureID) return;
     glActiveTexture(GL_TEXTURE0 + slot);
     glBindTexture(GL_TEXTURE_2D, textureID);
 }
 
 void Texture::Unbind() const {
+    if (!textureID) return;
     glBindTexture(GL_TEXTURE_2D, 0);
 }
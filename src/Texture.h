@@ -6,9 +6,13 @@
 class Texture {
 public:
     Texture(const char* imagePath);
-    Texture(int width, int height, unsigned char* data, int channels = 4);
+    Texture(int width, int height, const unsigned char* data, int channels = 4);
     ~Texture();
 
+    // Replace the image in place, keeping the same GL texture object (so
+    // every Texture* holder sees the new contents)
+    void Upload(int width, int height, const unsigned char* data, int channels = 4);
+
     void Bind(unsigned int slot = 0) const;
     void Unbind() const;
 
@@ -17,7 +21,7 @@ public:
     unsigned int GetID() const { return textureID; }
 
 private:
-    void CreateFromData(int w, int h, unsigned char* data, int ch);
+    void CreateFromData(int w, int h, const unsigned char* data, int ch);
 
     unsigned int textureID;
     int width;
@@ -3,74 +3,98 @@
 #include "Shader.h"
 #include "Camera2D.h"
 #include "Texture.h"
+#include "FrameUniforms.h"
+#include "Core/Profiler.h"
 #include <glad/glad.h>
-
-Tilemap::Tilemap(int width, int height, int tileSize)
-    : width(width), height(height), tileSize(tileSize), spriteSheet(nullptr), VAO(0), VBO(0) {
-    tiles.resize(width * height, -1);  // -1 = empty
-    solidTiles.resize(256, false);  // Support up to 256 tile types
-    SetupBuffers();
-}
+#include <algorithm>
 
 Tilemap::~Tilemap() {
-    if (VAO) glDeleteVertexArrays(1, &VAO);
-    if (VBO) glDeleteBuffers(1, &VBO);
+    for (auto& chunk : chunks) {
+        if (chunk.VAO) glDeleteVertexArrays(1, &chunk.VAO);
+        if (chunk.VBO) glDeleteBuffers(1, &chunk.VBO);
+    }
 }
 
-void Tilemap::SetupBuffers() {
-    float vertices[] = {
-        // pos      // tex
-        0.0f, 1.0f, 0.0f, 1.0f,
-        1.0f, 0.0f, 1.0f, 0.0f,
-        0.0f, 0.0f, 0.0f, 0.0f,
-
-        0.0f, 1.0f, 0.0f, 1.0f,
-        1.0f, 1.0f, 1.0f, 1.0f,
-        1.0f, 0.0f, 1.0f, 0.0f
-    };
-
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+void Tilemap::SetSpriteSheet(SpriteSheet* sheet) {
+    if (spriteSheet != sheet) {
+        spriteSheet = sheet;
+        MarkAllChunksDirty();
+    }
 }
 
-void Tilemap::SetTile(int x, int y, int tileId) {
-    if (x >= 0 && x < width && y >= 0 && y < height) {
-        tiles[y * width + x] = tileId;
+void Tilemap::MarkAllChunksDirty() {
+    for (auto& chunk : chunks) {
+        chunk.dirty = true;
     }
 }
 
-int Tilemap::GetTile(int x, int y) const {
-    if (x >= 0 && x < width && y >= 0 && y < height) {
-        return tiles[y * width + x];
+void Tilemap::RebuildChunk(int chunkX, int chunkY) {
+    Chunk& chunk = chunks[chunkY * chunksX + chunkX];
+    chunk.dirty = false;
+
+    int startX = chunkX * CHUNK_SIZE;
+    int startY = chunkY * CHUNK_SIZE;
+    int endX = std::min(startX + CHUNK_SIZE, width);
+    int endY = std::min(startY + CHUNK_SIZE, height);
+
+    // Two triangles per tile, world-space position + sprite sheet UV,
+    // matching the unit quad layout the default shader expects
+    chunkVertices.clear();
+    float size = static_cast<float>(tileSize);
+    for (int y = startY; y < endY; y++) {
+        for (int x = startX; x < endX; x++) {
+            int tileId = tiles[y * width + x];
+            if (tileId < 0) continue;
+
+            Frame frame = spriteSheet->GetFrame(tileId);
+            float x0 = static_cast<float>(x * tileSize);
+            float y0 = static_cast<float>(y * tileSize);
+            float x1 = x0 + size;
+            float y1 = y0 + size;
+
+            const float quad[] = {
+                x0, y1, frame.u0, frame.v1,
+                x1, y0, frame.u1, frame.v0,
+                x0, y0, frame.u0, frame.v0,
+
+                x0, y1, frame.u0, frame.v1,
+                x1, y1, frame.u1, frame.v1,
+                x1, y0, frame.u1, frame.v0
+            };
+            chunkVertices.insert(chunkVertices.end(), quad, quad + 24);
+        }
     }
-    return -1;
-}
 
-void Tilemap::SetSpriteSheet(SpriteSheet* sheet) {
-    spriteSheet = sheet;
-}
+    chunk.vertexCount = static_cast<int>(chunkVertices.size() / 4);
+    if (chunk.vertexCount == 0) return;
+
+    if (!chunk.VAO) {
+        glGenVertexArrays(1, &chunk.VAO);
+        glGenBuffers(1, &chunk.VBO);
 
-void Tilemap::SetCollisionTile(int tileId, bool solid) {
-    if (tileId >= 0 && tileId < static_cast<int>(solidTiles.size())) {
-        solidTiles[tileId] = solid;
+        glBindVertexArray(chunk.VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, chunk.VBO);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+    } else {
+        glBindVertexArray(chunk.VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, chunk.VBO);
     }
+
+    glBufferData(GL_ARRAY_BUFFER, chunkVertices.size() * sizeof(float), chunkVertices.data(), GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
 }
 
 void Tilemap::Render(Shader* shader, Camera2D* camera) {
     if (!spriteSheet || !shader) return;
 
+    MOLGA_PROFILE("Tilemap::Render");
+    MOLGA_PROFILE_GPU("Tilemap");
+
     shader->Use();
 
     // Set projection
@@ -83,98 +107,44 @@ void Tilemap::Render(Shader* shader, Camera2D* camera) {
         mat4x4_identity(view);
     }
     mat4x4_mul(projView, projection, view);
-    shader->SetMat4("projection", (float*)projView);
+    FrameUniforms::SetProjection((float*)projView);
 
     spriteSheet->GetTexture()->Bind(0);
     shader->SetInt("uTexture", 0);
     shader->SetBool("useTexture", true);
     shader->SetVec4("uColor", 1.0f, 1.0f, 1.0f, 1.0f);
 
-    glBindVertexArray(VAO);
+    // Vertices are already in world space
+    mat4x4 model;
+    mat4x4_identity(model);
+    shader->SetMat4("model", (float*)model);
+    shader->SetVec4("uUV", 0.0f, 0.0f, 1.0f, 1.0f);
 
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int tileId = tiles[y * width + x];
-            if (tileId < 0) continue;
-
-            Frame frame = spriteSheet->GetFrame(tileId);
-
-            mat4x4 model;
-            mat4x4_identity(model);
-            mat4x4_translate_in_place(model, static_cast<float>(x * tileSize), static_cast<float>(y * tileSize), 0.0f);
-            mat4x4_scale_aniso(model, model, static_cast<float>(tileSize), static_cast<float>(tileSize), 1.0f);
-
-            shader->SetMat4("model", (float*)model);
-            shader->SetVec4("uUV", frame.u0, frame.v0, frame.u1, frame.v1);
-
-            glDrawArrays(GL_TRIANGLES, 0, 6);
-        }
-    }
-
-    glBindVertexArray(0);
-}
-
-bool Tilemap::IsSolid(int x, int y) const {
-    int tileId = GetTile(x, y);
-    if (tileId < 0 || tileId >= static_cast<int>(solidTiles.size())) {
-        return false;
+    // Only visit chunks that overlap the camera view
+    int firstChunkX = 0, firstChunkY = 0;
+    int lastChunkX = chunksX - 1, lastChunkY = chunksY - 1;
+    if (camera) {
+        AABB view = camera->GetWorldBounds();
+        float chunkWorldSize = static_cast<float>(CHUNK_SIZE * tileSize);
+        firstChunkX = std::max(firstChunkX, static_cast<int>(std::floor(view.Left() / chunkWorldSize)));
+        firstChunkY = std::max(firstChunkY, static_cast<int>(std::floor(view.Top() / chunkWorldSize)));
+        lastChunkX = std::min(lastChunkX, static_cast<int>(std::floor(view.Right() / chunkWorldSize)));
+        lastChunkY = std::min(lastChunkY, static_cast<int>(std::floor(view.Bottom() / chunkWorldSize)));
     }
-    return solidTiles[tileId];
-}
-
-int Tilemap::WorldToTileX(float worldX) const {
-    return static_cast<int>(worldX / tileSize);
-}
 
-int Tilemap::WorldToTileY(float worldY) const {
-    return static_cast<int>(worldY / tileSize);
-}
+    for (int cy = firstChunkY; cy <= lastChunkY; cy++) {
+        for (int cx = firstChunkX; cx <= lastChunkX; cx++) {
+            if (chunks[cy * chunksX + cx].dirty) {
+                RebuildChunk(cx, cy);
+            }
 
-AABB Tilemap::GetTileAABB(int x, int y) const {
-    return {
-        static_cast<float>(x * tileSize),
-        static_cast<float>(y * tileSize),
-        static_cast<float>(tileSize),
-        static_cast<float>(tileSize)
-    };
-}
+            const Chunk& chunk = chunks[cy * chunksX + cx];
+            if (chunk.vertexCount == 0) continue;
 
-bool Tilemap::CheckCollision(const AABB& box) const {
-    int startX = WorldToTileX(box.Left());
-    int endX = WorldToTileX(box.Right());
-    int startY = WorldToTileY(box.Top());
-    int endY = WorldToTileY(box.Bottom());
-
-    for (int y = startY; y <= endY; y++) {
-        for (int x = startX; x <= endX; x++) {
-            if (IsSolid(x, y)) {
-                AABB tileBox = GetTileAABB(x, y);
-                if (Collision::CheckAABB(box, tileBox)) {
-                    return true;
-                }
-            }
+            glBindVertexArray(chunk.VAO);
+            glDrawArrays(GL_TRIANGLES, 0, chunk.vertexCount);
         }
     }
-    return false;
-}
 
-std::vector<AABB> Tilemap::GetCollidingTiles(const AABB& box) const {
-    std::vector<AABB> result;
-
-    int startX = WorldToTileX(box.Left());
-    int endX = WorldToTileX(box.Right());
-    int startY = WorldToTileY(box.Top());
-    int endY = WorldToTileY(box.Bottom());
-
-    for (int y = startY; y <= endY; y++) {
-        for (int x = startX; x <= endX; x++) {
-            if (IsSolid(x, y)) {
-                AABB tileBox = GetTileAABB(x, y);
-                if (Collision::CheckAABB(box, tileBox)) {
-                    result.push_back(tileBox);
-                }
-            }
-        }
-    }
-    return result;
+    glBindVertexArray(0);
 }
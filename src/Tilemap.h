@@ -9,6 +9,16 @@ class SpriteSheet;
 class Shader;
 class Camera2D;
 
+// Result of Tilemap::SweepAABB
+struct TileSweepResult {
+    bool hit = false;
+    float time = 1.0f;          // Fraction of the velocity travelled before contact
+    float normalX = 0.0f;       // Surface normal of the tile that was hit. Both
+    float normalY = 0.0f;       // are set when a corner is hit head on.
+    int tileX = -1;
+    int tileY = -1;
+};
+
 class Tilemap {
 public:
     Tilemap(int width, int height, int tileSize);
@@ -27,6 +37,21 @@ public:
     bool CheckCollision(const AABB& box) const;
     std::vector<AABB> GetCollidingTiles(const AABB& box) const;
 
+    // Non-allocating variants. fn(const AABB& tile) is called for every
+    // solid tile overlapping box; the array form writes up to capacity
+    // tiles and returns how many overlap (more than capacity if truncated).
+    template<typename F>
+    void ForEachCollidingTile(const AABB& box, F&& fn) const;
+    int GetCollidingTiles(const AABB& box, AABB* out, int capacity) const;
+
+    // Move box by velocity, walking the tile cells its leading edges cross
+    // (DDA), and stop at the first solid one. Unlike testing the end
+    // position, nothing is skipped however far the box moves. Tiles the box
+    // already overlaps are ignored, so a stuck body can move out. A box
+    // left touching a wall after a hit does not collide with it again
+    // unless it moves into it.
+    TileSweepResult SweepAABB(const AABB& box, const Vector2& velocity) const;
+
     // World to tile conversion
     int WorldToTileX(float worldX) const;
     int WorldToTileY(float worldY) const;
@@ -39,14 +64,53 @@ public:
     float GetWorldHeight() const { return static_cast<float>(height * tileSize); }
 
 private:
+    // Tiles are baked into static vertex buffers per CHUNK_SIZE x CHUNK_SIZE
+    // block. A chunk is rebuilt only after SetTile changes one of its cells.
+    static constexpr int CHUNK_SIZE = 32;
+
+    struct Chunk {
+        unsigned int VAO = 0;
+        unsigned int VBO = 0;
+        int vertexCount = 0;
+        bool dirty = true;
+    };
+
+    // Edges within this fraction of a tile of a cell boundary count as
+    // touching, not overlapping, so a box stopped by SweepAABB stays clear
+    // of float error
+    static constexpr float EDGE_EPSILON = 1e-3f;
+
+    // Cells [x0, x1) x [y0, y1) a box overlaps, clamped to the map
+    void GetTileRange(const AABB& box, int& x0, int& y0, int& x1, int& y1) const;
+    int FirstCell(float edge) const;
+    int EndCell(float edge) const;
+    bool FindSolid(int x0, int y0, int x1, int y1, int& outX, int& outY) const;
+
+    void RebuildChunk(int chunkX, int chunkY);
+    void MarkAllChunksDirty();
+
     int width, height;
     int tileSize;
     std::vector<int> tiles;
     std::vector<bool> solidTiles;
     SpriteSheet* spriteSheet;
 
-    unsigned int VAO, VBO;
-    void SetupBuffers();
+    int chunksX, chunksY;
+    std::vector<Chunk> chunks;
+    std::vector<float> chunkVertices;  // Scratch buffer reused by RebuildChunk
 };
 
+template<typename F>
+void Tilemap::ForEachCollidingTile(const AABB& box, F&& fn) const {
+    int x0, y0, x1, y1;
+    GetTileRange(box, x0, y0, x1, y1);
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            if (IsSolid(x, y)) {
+                fn(GetTileAABB(x, y));
+            }
+        }
+    }
+}
+
 #endif // MOLGA_TILEMAP_H
@@ -0,0 +1,223 @@
+#include "Tilemap.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+Tilemap::Tilemap(int width, int height, int tileSize)
+    : width(width), height(height), tileSize(tileSize), spriteSheet(nullptr) {
+    tiles.resize(width * height, -1);  // -1 = empty
+    solidTiles.resize(256, false);  // Support up to 256 tile types
+
+    chunksX = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunksY = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunks.resize(chunksX * chunksY);
+}
+
+void Tilemap::SetTile(int x, int y, int tileId) {
+    if (x >= 0 && x < width && y >= 0 && y < height) {
+        int& tile = tiles[y * width + x];
+        if (tile == tileId) return;
+        tile = tileId;
+        chunks[(y / CHUNK_SIZE) * chunksX + (x / CHUNK_SIZE)].dirty = true;
+    }
+}
+
+int Tilemap::GetTile(int x, int y) const {
+    if (x >= 0 && x < width && y >= 0 && y < height) {
+        return tiles[y * width + x];
+    }
+    return -1;
+}
+
+void Tilemap::SetCollisionTile(int tileId, bool solid) {
+    if (tileId >= 0 && tileId < static_cast<int>(solidTiles.size())) {
+        solidTiles[tileId] = solid;
+    }
+}
+
+bool Tilemap::IsSolid(int x, int y) const {
+    int tileId = GetTile(x, y);
+    if (tileId < 0 || tileId >= static_cast<int>(solidTiles.size())) {
+        return false;
+    }
+    return solidTiles[tileId];
+}
+
+int Tilemap::WorldToTileX(float worldX) const {
+    return static_cast<int>(worldX / tileSize);
+}
+
+int Tilemap::WorldToTileY(float worldY) const {
+    return static_cast<int>(worldY / tileSize);
+}
+
+AABB Tilemap::GetTileAABB(int x, int y) const {
+    return {
+        static_cast<float>(x * tileSize),
+        static_cast<float>(y * tileSize),
+        static_cast<float>(tileSize),
+        static_cast<float>(tileSize)
+    };
+}
+
+int Tilemap::FirstCell(float edge) const {
+    return static_cast<int>(std::floor(edge / tileSize + EDGE_EPSILON));
+}
+
+int Tilemap::EndCell(float edge) const {
+    return static_cast<int>(std::ceil(edge / tileSize - EDGE_EPSILON));
+}
+
+void Tilemap::GetTileRange(const AABB& box, int& x0, int& y0, int& x1, int& y1) const {
+    // Cells outside the map are never solid
+    x0 = std::max(FirstCell(box.Left()), 0);
+    y0 = std::max(FirstCell(box.Top()), 0);
+    x1 = std::min(EndCell(box.Right()), width);
+    y1 = std::min(EndCell(box.Bottom()), height);
+}
+
+bool Tilemap::FindSolid(int x0, int y0, int x1, int y1, int& outX, int& outY) const {
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, width);
+    y1 = std::min(y1, height);
+
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            if (IsSolid(x, y)) {
+                outX = x;
+                outY = y;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool Tilemap::CheckCollision(const AABB& box) const {
+    int x0, y0, x1, y1;
+    GetTileRange(box, x0, y0, x1, y1);
+
+    int tileX, tileY;
+    return FindSolid(x0, y0, x1, y1, tileX, tileY);
+}
+
+std::vector<AABB> Tilemap::GetCollidingTiles(const AABB& box) const {
+    std::vector<AABB> result;
+    ForEachCollidingTile(box, [&result](const AABB& tile) {
+        result.push_back(tile);
+    });
+    return result;
+}
+
+int Tilemap::GetCollidingTiles(const AABB& box, AABB* out, int capacity) const {
+    int count = 0;
+    ForEachCollidingTile(box, [&](const AABB& tile) {
+        if (count < capacity) out[count] = tile;
+        count++;
+    });
+    return count;
+}
+
+TileSweepResult Tilemap::SweepAABB(const AABB& box, const Vector2& velocity) const {
+    TileSweepResult result;
+    if (velocity.x == 0.0f && velocity.y == 0.0f) return result;
+
+    const float size = static_cast<float>(tileSize);
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    // Next column / row the leading edges enter, the time they reach it,
+    // and the time it takes to cross one cell
+    int stepX = velocity.x > 0.0f ? 1 : (velocity.x < 0.0f ? -1 : 0);
+    int stepY = velocity.y > 0.0f ? 1 : (velocity.y < 0.0f ? -1 : 0);
+    int column = 0, row = 0;
+    float nextX = infinity, nextY = infinity;
+    float deltaX = infinity, deltaY = infinity;
+
+    if (stepX > 0) {
+        column = EndCell(box.Right());
+        nextX = (column * size - box.Right()) / velocity.x;
+    } else if (stepX < 0) {
+        column = FirstCell(box.Left()) - 1;
+        nextX = ((column + 1) * size - box.Left()) / velocity.x;
+    }
+    if (stepY > 0) {
+        row = EndCell(box.Bottom());
+        nextY = (row * size - box.Bottom()) / velocity.y;
+    } else if (stepY < 0) {
+        row = FirstCell(box.Top()) - 1;
+        nextY = ((row + 1) * size - box.Top()) / velocity.y;
+    }
+    if (stepX) deltaX = size / std::fabs(velocity.x);
+    if (stepY) deltaY = size / std::fabs(velocity.y);
+
+    // A box resting within EDGE_EPSILON of a wall starts touching it
+    nextX = std::max(nextX, 0.0f);
+    nextY = std::max(nextY, 0.0f);
+
+    while (true) {
+        float time = std::min(nextX, nextY);
+        if (time > 1.0f) return result;
+
+        // Heading away from the map with nothing left to enter
+        bool doneX = stepX == 0 || (stepX > 0 ? column >= width : column < 0);
+        bool doneY = stepY == 0 || (stepY > 0 ? row >= height : row < 0);
+        if (doneX && doneY) return result;
+
+        bool crossX = nextX <= time;
+        bool crossY = nextY <= time;
+
+        // Cells the box spans on the other axis when it reaches the
+        // boundary. The leading side comes from the walk itself: a cell
+        // entered less than EDGE_EPSILON deep must still count.
+        AABB moved(box.x + velocity.x * time, box.y + velocity.y * time, box.width, box.height);
+        int x0 = FirstCell(moved.Left());
+        int x1 = EndCell(moved.Right());
+        int y0 = FirstCell(moved.Top());
+        int y1 = EndCell(moved.Bottom());
+        if (stepX > 0) x1 = column;
+        if (stepX < 0) x0 = column + 1;
+        if (stepY > 0) y1 = row;
+        if (stepY < 0) y0 = row + 1;
+
+        int tileX, tileY;
+        bool hitX = crossX && FindSolid(column, y0, column + 1, y1, tileX, tileY);
+        bool hitY = crossY && FindSolid(x0, row, x1, row + 1, tileX, tileY);
+
+        // Reaching a column and a row at once also enters the diagonal cell
+        bool hitCorner = false;
+        if (crossX && crossY && !hitX && !hitY && IsSolid(column, row)) {
+            hitCorner = true;
+            tileX = column;
+            tileY = row;
+        }
+
+        if (hitX || hitY || hitCorner) {
+            result.hit = true;
+            result.time = time;
+            result.tileX = tileX;
+            result.tileY = tileY;
+            if (hitCorner) {
+                // Block the minor axis so the body slides along its main direction
+                if (std::fabs(velocity.x) >= std::fabs(velocity.y)) {
+                    result.normalY = static_cast<float>(-stepY);
+                } else {
+                    result.normalX = static_cast<float>(-stepX);
+                }
+            } else {
+                if (hitX) result.normalX = static_cast<float>(-stepX);
+                if (hitY) result.normalY = static_cast<float>(-stepY);
+            }
+            return result;
+        }
+
+        if (crossX) {
+            column += stepX;
+            nextX += deltaX;
+        }
+        if (crossY) {
+            row += stepY;
+            nextY += deltaY;
+        }
+    }
+}
@@ -1,5 +1,16 @@
 #include "Time.h"
-#include <GLFW/glfw3.h>
+#include <chrono>
+
+namespace {
+
+// Steady clock rather than glfwGetTime, so headless builds need no GLFW
+const std::chrono::steady_clock::time_point g_clockStart = std::chrono::steady_clock::now();
+
+float ReadClock() {
+    return std::chrono::duration<float>(std::chrono::steady_clock::now() - g_clockStart).count();
+}
+
+} // namespace
 
 float Time::deltaTime = 0.0f;
 float Time::lastTime = 0.0f;
@@ -12,7 +23,7 @@ float Time::fpsAccumulator = 0.0f;
 int Time::fpsFrameCount = 0;
 
 void Time::Init() {
-    lastTime = static_cast<float>(glfwGetTime());
+    lastTime = ReadClock();
     currentTime = lastTime;
     deltaTime = 0.0f;
     fps = 0.0f;
@@ -22,8 +33,12 @@ void Time::Init() {
 }
 
 void Time::Update() {
-    currentTime = static_cast<float>(glfwGetTime());
-    deltaTime = currentTime - lastTime;
+    Step(ReadClock() - lastTime);
+}
+
+void Time::Step(float dt) {
+    currentTime = lastTime + dt;
+    deltaTime = dt;
     lastTime = currentTime;
     frameCount++;
 
@@ -6,6 +6,10 @@ public:
     static void Init();
     static void Update();
 
+    // Advance by a fixed amount instead of reading the clock (headless runs
+    // with --fixed-dt, where simulated time must not depend on wall time)
+    static void Step(float dt);
+
     static float GetDeltaTime() { return deltaTime; }
     static float GetTime() { return currentTime; }
     static float GetFPS() { return fps; }
@@ -3,6 +3,8 @@
 #include "Shader.h"
 #include "Sprite.h"
 #include "Input.h"
+#include "FrameUniforms.h"
+#include "Core/Profiler.h"
 #include <algorithm>
 
 // ============ UIElement ============
@@ -243,11 +245,14 @@ void UIManager::Update(float dt) {
 void UIManager::Render(Renderer* renderer, Shader* shader, float screenWidth, float screenHeight) {
     if (!shader) return;
 
+    MOLGA_PROFILE("UIManager::Render");
+    MOLGA_PROFILE_GPU("UI");
+
     // Set up orthographic projection for UI (screen coordinates)
     mat4x4_ortho(uiProjection, 0.0f, screenWidth, screenHeight, 0.0f, -1.0f, 1.0f);
 
     shader->Use();
-    shader->SetMat4("projection", (float*)uiProjection);
+    FrameUniforms::SetProjection((float*)uiProjection);
 
     // Reset model matrix for UI
     mat4x4 identity;
@@ -4,9 +4,13 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <cctype>
+#include <cstdlib>
 
 #include "Shader.h"
 #include "Renderer.h"
+#include "RenderQueue.h"
+#include "FrameUniforms.h"
 #include "Time.h"
 #include "Input.h"
 #include "Camera2D.h"
@@ -17,6 +21,12 @@
 #include "Editor/Editor.h"
 #include "Editor/Windows/ProjectWindow.h"
 #include "Core/Project.h"
+#include "Core/TextureManager.h"
+#include "Core/AssetWatcher.h"
+#include "Core/SimulationLoop.h"
+#include "Core/Profiler.h"
+#include "Core/TraceWriter.h"
+#include "Core/JobSystem.h"
 #include "ECS/GameObject.h"
 #include "ECS/Components/Transform.h"
 #include "ECS/Components/SpriteRenderer.h"
@@ -37,6 +47,9 @@ const unsigned int SCR_HEIGHT = 600;
 // Global resources (shared between scenes)
 Renderer* g_renderer = nullptr;
 Shader* g_shader = nullptr;
+Shader* g_batchShader = nullptr;
+Shader* g_sdfTextShader = nullptr;
+Shader* g_particleShader = nullptr;
 Camera2D* g_camera = nullptr;
 GLFWwindow* g_window = nullptr;
 
@@ -44,10 +57,34 @@ GLFWwindow* g_window = nullptr;
 std::vector<std::shared_ptr<GameObject>> g_editorObjects;
 
 int main(int argc, char* argv[]) {
-    // Check for project path argument
+    // Arguments: [projectPath] [--trace [file]] [--jobs [workers]]
     std::string projectPath;
-    if (argc > 1) {
-        projectPath = argv[1];
+    std::string tracePath;
+    bool jobs = false;
+    unsigned int jobWorkers = 0;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--trace") {
+            tracePath = "trace.json";
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                tracePath = argv[++i];
+            }
+        } else if (arg == "--jobs") {
+            // Optional worker count; defaults to the hardware thread count
+            jobs = true;
+            if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                jobWorkers = static_cast<unsigned int>(std::atoi(argv[++i]));
+            }
+        } else if (projectPath.empty()) {
+            projectPath = arg;
+        }
+    }
+
+    if (!tracePath.empty()) {
+        TraceWriter::Get().Start(tracePath);
+    }
+    if (jobs) {
+        JobSystem::Get().Init(jobWorkers);
     }
 
     glfwInit();
@@ -82,11 +119,23 @@ int main(int argc, char* argv[]) {
     Input::Init(window);
     Audio::Init();
     ImGuiLayer::Init(window);
+    Profiler::Get().InitGpu();
 
     // Initialize global resources
     g_renderer = new Renderer();
     g_renderer->Init();
     g_shader = new Shader("src/Shaders/default.vert", "src/Shaders/default.frag");
+    g_batchShader = new Shader("src/Shaders/sprite_batch.vert", "src/Shaders/sprite_batch.frag");
+    g_renderer->SetBatchShader(g_batchShader, g_shader);
+    g_sdfTextShader = new Shader("src/Shaders/sprite_batch.vert", "src/Shaders/sdf_text.frag");
+    TextRenderer::Get().SetSdfShader(g_sdfTextShader);
+    g_particleShader = new Shader("src/Shaders/particle.vert", "src/Shaders/particle.frag");
+    g_renderer->SetParticleShader(g_particleShader);
+
+    // Recompile shaders when their sources are saved (project assets are
+    // watched by the Editor once a project is open)
+    AssetWatcher::Get().Watch("src/Shaders");
+
     g_camera = new Camera2D(static_cast<float>(SCR_WIDTH), static_cast<float>(SCR_HEIGHT));
 
     // Initialize Scripting
@@ -175,9 +224,14 @@ int main(int argc, char* argv[]) {
 
     // Main editor loop
     while (!glfwWindowShouldClose(window)) {
+        Profiler::Get().BeginFrame();
         Time::Update();
         Input::Update();
         float dt = Time::GetDeltaTime();
+        FrameUniforms::SetTime(Time::GetTime());
+
+        // Upload textures finished by the background loader
+        TextureManager::Get().Update();
 
         // Get editor state
         EditorState& editorState = EditorState::Get();
@@ -204,31 +258,42 @@ int main(int argc, char* argv[]) {
             float scaledDt = dt * editorState.GetTimeScale();
             SceneManager::Update(scaledDt);
 
-            // Update ECS GameObjects scripts
-            for (auto& obj : g_editorObjects) {
-                if (obj && obj->IsActive()) {
-                    obj->Update(scaledDt);
-                }
-            }
+            // FixedUpdate + physics at the fixed rate, then Update and LateUpdate
+            SimulationLoop::Get().Tick(scaledDt, g_editorObjects);
+        } else {
+            SimulationLoop::Get().Reset();
         }
 
+        // Resolve world transforms once, parents before children
+        Transform::UpdateWorldTransforms();
+
         // Render based on editor mode
-        if (editorState.IsEditMode()) {
-            // Edit mode: Render editor scene with g_editorObjects
-            g_renderer->Clear(0.15f, 0.15f, 0.2f, 1.0f);
-            g_renderer->Begin(g_shader, g_camera);
-            for (auto& obj : g_editorObjects) {
-                if (obj && obj->IsActive()) {
-                    auto sr = obj->GetComponent<SpriteRenderer>();
-                    if (sr) {
-                        sr->RenderSprite(g_renderer, g_shader, g_camera);
+        {
+            MOLGA_PROFILE("Render");
+            if (editorState.IsEditMode()) {
+                // Edit mode: Render editor scene with g_editorObjects
+                g_renderer->Clear(0.15f, 0.15f, 0.2f, 1.0f);
+                // Objects are moved by hand here, so each is tested against
+                // the view instead of going through SpriteCuller's static index
+                AABB view = g_camera->GetWorldBounds();
+                g_renderer->Begin(g_shader, g_camera);
+                for (auto& obj : g_editorObjects) {
+                    if (obj && obj->IsActive()) {
+                        auto sr = obj->GetComponent<SpriteRenderer>();
+                        auto transform = obj->GetComponent<Transform>();
+                        if (sr && sr->IsEnabled() && transform && view.Intersects(sr->GetWorldBounds(*transform))) {
+                            Sprite sprite;
+                            sr->BuildSprite(*transform, sprite);
+                            RenderQueue::Get().Submit(sprite, sr->GetSortingLayer(), sr->GetSortingOrder());
+                        }
                     }
                 }
+                RenderQueue::Get().Flush(g_renderer, g_shader, g_camera);
+                g_renderer->End();
+            } else {
+                // Play/Pause mode: Render game scene
+                SceneManager::Render(g_renderer, g_shader, g_camera);
             }
-            g_renderer->End();
-        } else {
-            // Play/Pause mode: Render game scene
-            SceneManager::Render(g_renderer, g_shader, g_camera);
         }
 
         // ImGui Editor UI
@@ -239,6 +304,7 @@ int main(int argc, char* argv[]) {
 
         glfwSwapBuffers(window);
         glfwPollEvents();
+        Profiler::Get().EndFrame();
     }
 
 cleanup:
@@ -249,7 +315,13 @@ cleanup:
     ImGuiLayer::Shutdown();
     SceneManager::Clear();
     TextRenderer::Get().Shutdown();
+    Profiler::Get().ShutdownGpu();
+    JobSystem::Get().Shutdown();
+    TraceWriter::Get().Stop();
     delete g_camera;
+    delete g_particleShader;
+    delete g_sdfTextShader;
+    delete g_batchShader;
     delete g_shader;
     delete g_renderer;
     Audio::Shutdown();
@@ -1,29 +1,52 @@
 // Molga Engine Runtime - Standalone game player without editor
+//
+// Also built as molga_server (MOLGA_HEADLESS): always headless, no window,
+// GL or GLFW.
+#ifndef MOLGA_HEADLESS
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#endif
 
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cctype>
+#include <cstdlib>
+#include <thread>
 
 #include "Shader.h"
 #include "Renderer.h"
+#include "RenderBackend.h"
+#include "FrameUniforms.h"
 #include "Time.h"
 #include "Input.h"
 #include "Camera2D.h"
+#include "SpriteCuller.h"
 #include "Audio.h"
-#include "TextRenderer.h"
 #include "ECS/GameObject.h"
 #include "ECS/Components/Transform.h"
 #include "ECS/Components/SpriteRenderer.h"
 #include "ECS/Components/BoxCollider2D.h"
 #include "Core/SceneSerializer.h"
+#include "Core/TextureManager.h"
+#include "Core/SimulationLoop.h"
+#include "Core/Profiler.h"
+#include "Core/TraceWriter.h"
+#include "Core/JobSystem.h"
 #include "Scripting/ScriptManager.h"
 #include "Scripting/BuiltinScripts.h"
 #include <nlohmann/json.hpp>
 
+#ifndef MOLGA_HEADLESS
+#include "TextRenderer.h"
+
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+#endif
 
 // Game configuration
 struct GameConfig {
@@ -32,13 +55,33 @@ struct GameConfig {
     int windowWidth = 800;
     int windowHeight = 600;
     bool fullscreen = false;
+    int fixedUpdateRate = 60;       // Simulation steps per second
+    int maxSubSteps = 5;            // Fixed steps allowed per frame
+    bool interpolate = true;        // Interpolate transforms between steps
+};
+
+// Command line options
+struct RuntimeOptions {
+    bool profile = false;           // --profile
+    std::string tracePath;          // --trace [file]
+    bool headless = false;          // --headless
+    long long frames = 0;           // --frames N: headless frames to run, 0 = until interrupted
+    float fixedDt = 0.0f;           // --fixed-dt S: headless time per frame, 0 = simulation step
+    bool realtime = false;          // --realtime: headless frames paced to wall time
+    bool jobs = false;              // --jobs [N]: parallel engine updates on N workers
+    unsigned int jobWorkers = 0;    // 0 = one per hardware thread
 };
 
 // Global resources
 Renderer* g_renderer = nullptr;
 Shader* g_shader = nullptr;
+Shader* g_batchShader = nullptr;
+Shader* g_sdfTextShader = nullptr;
+Shader* g_particleShader = nullptr;
 Camera2D* g_camera = nullptr;
+#ifndef MOLGA_HEADLESS
 GLFWwindow* g_window = nullptr;
+#endif
 std::vector<std::shared_ptr<GameObject>> g_gameObjects;
 
 bool LoadGameConfig(const std::string& path, GameConfig& config) {
@@ -57,6 +100,9 @@ bool LoadGameConfig(const std::string& path, GameConfig& config) {
         if (j.contains("windowWidth")) config.windowWidth = j["windowWidth"];
         if (j.contains("windowHeight")) config.windowHeight = j["windowHeight"];
         if (j.contains("fullscreen")) config.fullscreen = j["fullscreen"];
+        if (j.contains("fixedUpdateRate")) config.fixedUpdateRate = j["fixedUpdateRate"];
+        if (j.contains("maxSubSteps")) config.maxSubSteps = j["maxSubSteps"];
+        if (j.contains("interpolate")) config.interpolate = j["interpolate"];
 
         return true;
     } catch (const std::exception& e) {
@@ -65,13 +111,158 @@ bool LoadGameConfig(const std::string& path, GameConfig& config) {
     }
 }
 
-int main(int argc, char* argv[]) {
-    // Load game configuration
-    GameConfig config;
-    if (!LoadGameConfig("game.json", config)) {
-        std::cout << "Using default configuration" << std::endl;
+bool ParseOptions(int argc, char* argv[], RuntimeOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--profile") {
+            options.profile = true;
+        } else if (arg == "--trace") {
+            // Optional file name; defaults to trace.json
+            options.tracePath = "trace.json";
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                options.tracePath = argv[++i];
+            }
+        } else if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--frames" && i + 1 < argc) {
+            options.frames = std::atoll(argv[++i]);
+        } else if (arg == "--fixed-dt" && i + 1 < argc) {
+            options.fixedDt = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--realtime") {
+            options.realtime = true;
+        } else if (arg == "--jobs") {
+            options.jobs = true;
+            if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                options.jobWorkers = static_cast<unsigned int>(std::atoi(argv[++i]));
+            }
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [--profile] [--trace [file]] [--jobs [workers]]"
+                      << " [--headless [--frames N] [--fixed-dt seconds] [--realtime]]"
+                      << " | --convert-scene <input> <output>" << std::endl;
+            return false;
+        }
+    }
+
+    if (options.frames < 0 || options.fixedDt < 0.0f) {
+        std::cerr << "--frames and --fixed-dt must not be negative" << std::endl;
+        return false;
+    }
+
+#ifdef MOLGA_HEADLESS
+    options.headless = true;
+#endif
+    return true;
+}
+
+// Fixed simulation rate and script registration, shared by both loops
+void InitSimulation(const GameConfig& config) {
+    SimulationSettings simulation;
+    simulation.fixedDeltaTime = config.fixedUpdateRate > 0 ? 1.0f / config.fixedUpdateRate : 1.0f / 60.0f;
+    simulation.maxSubSteps = config.maxSubSteps;
+    simulation.interpolate = config.interpolate;
+    SimulationLoop::Get().SetSettings(simulation);
+
+    RegisterBuiltinScripts();
+}
+
+void LoadMainScene(const GameConfig& config) {
+    std::cout << "Loading scene: " << config.mainScene << std::endl;
+    if (!SceneSerializer::LoadScene(config.mainScene, g_gameObjects)) {
+        std::cerr << "Failed to load main scene!" << std::endl;
+        // Continue anyway with empty scene
+    }
+
+    std::cout << "Loaded " << g_gameObjects.size() << " game objects" << std::endl;
+
+    // Pack every sprite image of the scene into shared atlas pages so
+    // sprites with different images still batch together
+    std::vector<std::string> texturePaths;
+    EntityRegistry::Get().View<SpriteRenderer>().Each([&texturePaths](GameObject*, SpriteRenderer& sr) {
+        if (!sr.GetTexturePath().empty()) {
+            texturePaths.push_back(sr.GetTexturePath());
+        }
+    });
+    TextureManager::Get().BuildAtlas(texturePaths);
+    EntityRegistry::Get().View<SpriteRenderer>().Each([](GameObject*, SpriteRenderer& sr) {
+        sr.ResolveTexture();
+    });
+}
+
+std::atomic<bool> g_interrupted{false};
+
+void OnInterrupt(int) {
+    g_interrupted = true;
+}
+
+// Simulation only: no window, GL, audio or input. Each frame advances time
+// by a fixed amount, so a run is reproducible and as fast as the CPU allows
+// (unless --realtime), then prints ticks per second.
+int RunHeadless(const GameConfig& config, const RuntimeOptions& options) {
+    RenderBackend::SetNull(true);
+    std::signal(SIGINT, OnInterrupt);
+    std::signal(SIGTERM, OnInterrupt);
+
+    Time::Init();
+    Input::Init(nullptr);
+    if (options.profile) {
+        Profiler::Get().SetEnabled(true);
+    }
+
+    InitSimulation(config);
+    LoadMainScene(config);
+
+    const float dt = options.fixedDt > 0.0f ? options.fixedDt : SimulationLoop::Get().GetSettings().fixedDeltaTime;
+    std::cout << "Running headless, dt " << dt << " s, ";
+    if (options.frames > 0) {
+        std::cout << options.frames << " frames" << std::endl;
+    } else {
+        std::cout << "until interrupted" << std::endl;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    long long frame = 0;
+    while (!g_interrupted && (options.frames == 0 || frame < options.frames)) {
+        Profiler::Get().BeginFrame();
+        Time::Step(dt);
+        Input::Update();
+
+        SimulationLoop::Get().Tick(dt, g_gameObjects);
+        Transform::UpdateWorldTransforms();
+
+        Profiler::Get().EndFrame();
+        frame++;
+
+        if (options.profile && Profiler::IsEnabled() && frame % 120 == 0) {
+            Profiler::Get().PrintSummary(120);
+        }
+
+        // Keep simulated time in step with wall time (dedicated server)
+        if (options.realtime) {
+            std::this_thread::sleep_until(start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(frame * static_cast<double>(dt))));
+        }
     }
 
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    long long steps = SimulationLoop::Get().GetTotalSteps();
+    std::printf("[Headless] %lld frames, %lld fixed steps, %.3f s simulated in %.3f s\n",
+                frame, steps, frame * static_cast<double>(dt), seconds);
+    if (seconds > 0.0 && frame > 0) {
+        std::printf("[Headless] %.1f ticks/s (%.4f ms/tick), %.1f fixed steps/s\n",
+                    frame / seconds, seconds * 1000.0 / frame, steps / seconds);
+    }
+    std::fflush(stdout);
+
+    g_gameObjects.clear();
+    TextureManager::Get().Clear();
+    return 0;
+}
+
+#ifndef MOLGA_HEADLESS
+int RunWindowed(const GameConfig& config, const RuntimeOptions& options) {
+    bool profile = options.profile;
+
     // Initialize GLFW
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
@@ -109,69 +300,93 @@ int main(int argc, char* argv[]) {
     Input::Init(window);
     Audio::Init();
 
+    // Profiling: --profile starts recording, F3 toggles it
+    Profiler::Get().InitGpu();
+    if (profile) {
+        Profiler::Get().SetEnabled(true);
+    }
+
     // Initialize renderer
     g_renderer = new Renderer();
     g_renderer->Init();
     g_shader = new Shader("Shaders/default.vert", "Shaders/default.frag");
+    g_batchShader = new Shader("Shaders/sprite_batch.vert", "Shaders/sprite_batch.frag");
+    g_renderer->SetBatchShader(g_batchShader, g_shader);
+    g_sdfTextShader = new Shader("Shaders/sprite_batch.vert", "Shaders/sdf_text.frag");
+    TextRenderer::Get().SetSdfShader(g_sdfTextShader);
+    g_particleShader = new Shader("Shaders/particle.vert", "Shaders/particle.frag");
+    g_renderer->SetParticleShader(g_particleShader);
     g_camera = new Camera2D(static_cast<float>(config.windowWidth),
                             static_cast<float>(config.windowHeight));
 
-    // Initialize scripting
-    RegisterBuiltinScripts();
+    InitSimulation(config);
 
     // Initialize text renderer
     TextRenderer::Get().Init();
 
-    // Load main scene
-    std::cout << "Loading scene: " << config.mainScene << std::endl;
-    if (!SceneSerializer::LoadScene(config.mainScene, g_gameObjects)) {
-        std::cerr << "Failed to load main scene!" << std::endl;
-        // Continue anyway with empty scene
-    }
-
-    std::cout << "Loaded " << g_gameObjects.size() << " game objects" << std::endl;
+    LoadMainScene(config);
 
     // Main game loop
     while (!glfwWindowShouldClose(window)) {
+        Profiler::Get().BeginFrame();
         Time::Update();
         Input::Update();
         float dt = Time::GetDeltaTime();
+        FrameUniforms::SetTime(Time::GetTime());
 
-        // Update all game objects
-        for (auto& obj : g_gameObjects) {
-            if (obj && obj->IsActive()) {
-                obj->Update(dt);
-            }
-        }
+        // Upload textures finished by the background loader
+        TextureManager::Get().Update();
+
+        // FixedUpdate + physics at the fixed rate, then Update and LateUpdate
+        SimulationLoop::Get().Tick(dt, g_gameObjects);
+
+        // Resolve world transforms once, parents before children
+        Transform::UpdateWorldTransforms();
 
         // Clear and render
-        g_renderer->Clear(0.1f, 0.1f, 0.15f, 1.0f);
-
-        // Render all game objects
-        g_renderer->Begin(g_shader, g_camera);
-        for (auto& obj : g_gameObjects) {
-            if (obj && obj->IsActive()) {
-                auto sr = obj->GetComponent<SpriteRenderer>();
-                if (sr) {
-                    sr->RenderSprite(g_renderer, g_shader, g_camera);
-                }
-            }
+        {
+            MOLGA_PROFILE("Render");
+            g_renderer->Clear(0.1f, 0.1f, 0.15f, 1.0f);
+
+            // Render the game objects in view
+            g_renderer->Begin(g_shader, g_camera);
+            SpriteCuller::Get().Render(g_renderer, g_shader, g_camera);
+            g_renderer->End();
         }
-        g_renderer->End();
 
         glfwSwapBuffers(window);
         glfwPollEvents();
+        Profiler::Get().EndFrame();
+
+        // Print a profile summary every 120 recorded frames
+        if (profile && Profiler::IsEnabled() && Time::GetFrameCount() % 120 == 0) {
+            Profiler::Get().PrintSummary(120);
+
+            const CullStats& cull = SpriteCuller::Get().GetStats();
+            std::cout << "[SpriteCuller] " << cull.visible << " / " << cull.sprites << " sprites visible, "
+                      << cull.tested << " tested, " << cull.staticSprites << " static" << std::endl;
+        }
 
         // ESC to quit
         if (Input::GetKeyDown(GLFW_KEY_ESCAPE)) {
             glfwSetWindowShouldClose(window, true);
         }
+        // A running trace keeps the profiler recording
+        if (Input::GetKeyDown(GLFW_KEY_F3)) {
+            profile = !profile;
+            Profiler::Get().SetEnabled(profile || TraceWriter::Get().IsRecording());
+        }
     }
 
     // Cleanup
     g_gameObjects.clear();
+    TextureManager::Get().Clear();
     TextRenderer::Get().Shutdown();
+    Profiler::Get().ShutdownGpu();
     delete g_camera;
+    delete g_particleShader;
+    delete g_sdfTextShader;
+    delete g_batchShader;
     delete g_shader;
     delete g_renderer;
     Audio::Shutdown();
@@ -179,7 +394,51 @@ int main(int argc, char* argv[]) {
 
     return 0;
 }
+#endif
+
+int main(int argc, char* argv[]) {
+    // Scene conversion between JSON and .mscene, no window needed:
+    //   molga_runtime --convert-scene <input> <output>
+    if (argc >= 2 && std::string(argv[1]) == "--convert-scene") {
+        if (argc < 4) {
+            std::cerr << "Usage: " << argv[0] << " --convert-scene <input> <output>" << std::endl;
+            return 1;
+        }
+        return SceneSerializer::ConvertScene(argv[2], argv[3]) ? 0 : 1;
+    }
+
+    RuntimeOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    // Chrome trace capture covers loading too, so start before anything else
+    if (!options.tracePath.empty()) {
+        TraceWriter::Get().Start(options.tracePath);
+    }
+    if (options.jobs) {
+        JobSystem::Get().Init(options.jobWorkers);
+    }
+
+    // Load game configuration
+    GameConfig config;
+    if (!LoadGameConfig("game.json", config)) {
+        std::cout << "Using default configuration" << std::endl;
+    }
+
+#ifdef MOLGA_HEADLESS
+    int result = RunHeadless(config, options);
+#else
+    int result = options.headless ? RunHeadless(config, options) : RunWindowed(config, options);
+#endif
+
+    JobSystem::Get().Shutdown();
+    TraceWriter::Get().Stop();
+    return result;
+}
 
+#ifndef MOLGA_HEADLESS
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
     glViewport(0, 0, width, height);
 }
+#endif